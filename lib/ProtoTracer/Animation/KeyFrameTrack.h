@@ -2,6 +2,7 @@
 
 #include "KeyFrame.h"
 #include "..\Utils\Math\Mathematics.h"
+#include "..\Utils\Time\FrameContext.h"
 
 class KeyFrameInterpolation{
 public:
@@ -44,13 +45,17 @@ public:
     }
 
     float GetCurrentTime(){
-        currentTime = fmod(millis() / 1000.0f + timeOffset, stopFrameTime - startFrameTime) + startFrameTime;//normalize time and add offset
+        return GetCurrentTime(FrameContext::GetCurrentMillis() / 1000.0f);
+    }
+
+    float GetCurrentTime(float time){//time in seconds
+        currentTime = fmod(time + timeOffset, stopFrameTime - startFrameTime) + startFrameTime;//normalize time and add offset
 
         return currentTime;
     }
 
     void SetCurrentTime(float setTime){
-        float currentSecs = millis() / 1000.0f;
+        float currentSecs = FrameContext::GetCurrentMillis() / 1000.0f;
 
         //Test case: current time = 1.32s, set time = 1.09s, 1.59s
         timeOffset = setTime - currentSecs;//1.59 - 1.32 = 0.27, 1.09 - 1.32 = -0.23
@@ -110,8 +115,12 @@ public:
     }
 
     float Update(){
+        return Update(FrameContext::GetActive());
+    }
 
-        GetCurrentTime();
+    float Update(FrameContext* frame){
+        if (frame) GetCurrentTime(frame->GetMillis() / 1000.0f);
+        else GetCurrentTime(millis() / 1000.0f);
 
         byte previousFrame = 0, nextFrame = 0;
 
@@ -0,0 +1,223 @@
+#pragma once
+
+#include "Arduino.h"
+#include "..\..\..\..\Scene\Materials\Static\Image.h"
+#include "..\..\..\..\Scene\Materials\Material.h"
+#include "..\..\..\..\Utils\Time\FrameContext.h"
+
+//Image sequence stored as run length coded keyframes and delta frames, written by tools/ImageSequenceEncoder.py
+//each frame is decoded once into a RAM frame buffer the image samples from, so pixel lookups cost the same as ImageSequence
+//
+//frame: one type byte (keyFrame or deltaFrame) followed by tokens until every pixel is covered
+//token: 0x00 - 0x7F  literal, the next n + 1 bytes are palette indices
+//       0x80 - 0xBF  repeat, the next byte is written n - 0x80 + 2 times
+//       0xC0 - 0xFF  skip, n - 0xC0 + 1 pixels keep the value of the previous frame, only in delta frames
+class CompressedImageSequence : public Material {
+public:
+    static const uint8_t keyFrame = 0;
+    static const uint8_t deltaFrame = 1;
+
+private:
+    Image* image;
+    const uint8_t* frames;
+    const uint32_t* frameOffsets;//imageCount + 1 entries, the last one is the end of the stream
+    uint8_t* frameBuffer = nullptr;
+    uint32_t pixelCount = 0;
+    unsigned long startTime = 0;
+    unsigned int imageCount = 0;
+    float fps = 24.0f;
+    float frameTime = 0.0f;
+    unsigned int currentFrame = 0;
+    bool decoded = false;//frame buffer holds currentFrame
+    bool failed = false;
+    unsigned int failedFrame = 0;//first malformed frame found, frames that depend on it are never shown
+    uint32_t decodeTime = 0;
+
+    bool IsKeyFrame(unsigned int frame){
+        return frames[frameOffsets[frame]] == keyFrame;
+    }
+
+    unsigned int FindKeyFrame(unsigned int frame){
+        while (frame > 0 && !IsKeyFrame(frame)) frame--;
+
+        return frame;
+    }
+
+    bool Decode(unsigned int frame){
+        return DecodeFrame(frames + frameOffsets[frame], frameOffsets[frame + 1] - frameOffsets[frame], frameBuffer, pixelCount);
+    }
+
+    //a malformed frame leaves the buffer half written, decodes the last good frame again or clears the buffer without one
+    void Recover(bool hasGoodFrame, unsigned int goodFrame, unsigned int target){
+        if (hasGoodFrame){
+            for (unsigned int frame = FindKeyFrame(goodFrame); frame <= goodFrame; frame++){
+                Decode(frame);//decoded without error before, the stream is constant
+            }
+
+            currentFrame = goodFrame;
+        }
+        else{
+            memset(frameBuffer, 0, pixelCount);
+
+            currentFrame = target;//held until a target outside the broken chain
+        }
+    }
+
+    //brings the frame buffer to the target frame, a delta chain is followed from the frame buffer or the nearest keyframe before it
+    void Seek(unsigned int target){
+        if (decoded && target == currentFrame) return;
+
+        if (!frameBuffer){//the image is usually a member of the derived class, so it is only read once constructed
+            pixelCount = image->xPixels * image->yPixels;
+            frameBuffer = new uint8_t[pixelCount];
+
+            memset(frameBuffer, 0, pixelCount);
+
+            image->SetData(frameBuffer);
+        }
+
+        unsigned int start = FindKeyFrame(target);
+
+        if (failed && failedFrame >= start && failedFrame <= target) return;//the chain runs through the malformed frame, hold the last good one
+
+        if (decoded && currentFrame < target && currentFrame >= start) start = currentFrame + 1;//continue from the buffer
+
+        uint32_t startMicros = micros();
+
+        for (unsigned int frame = start; frame <= target; frame++){
+            if (!Decode(frame)){
+                failed = true;
+                failedFrame = frame;
+
+                if (frame > start) Recover(true, frame - 1, target);
+                else Recover(decoded, currentFrame, target);
+
+                decodeTime = micros() - startMicros;
+                decoded = true;
+
+                image->GetTexture()->Invalidate();
+
+                return;
+            }
+        }
+
+        decodeTime = micros() - startMicros;
+        currentFrame = target;
+        decoded = true;
+
+        image->GetTexture()->Invalidate();//same buffer with new contents, cached mip levels are stale
+    }
+
+public:
+    //decodes one frame into output, which has to hold the previous frame for delta frames, returns false for a malformed frame
+    static bool DecodeFrame(const uint8_t* frame, uint32_t length, uint8_t* output, uint32_t pixelCount){
+        if (length == 0) return false;
+
+        const uint8_t* end = frame + length;
+        uint32_t pixel = 0;
+
+        bool isKeyFrame = *frame++ == keyFrame;//a keyframe has no previous frame to skip over
+
+        while (frame < end && pixel < pixelCount){
+            uint8_t token = *frame++;
+
+            if (token < 0x80){
+                uint32_t count = token + 1;
+
+                if (count > pixelCount - pixel || count > uint32_t(end - frame)) return false;
+
+                memcpy(output + pixel, frame, count);
+
+                frame += count;
+                pixel += count;
+            }
+            else if (token < 0xC0){
+                uint32_t count = token - 0x80 + 2;
+
+                if (count > pixelCount - pixel || frame >= end) return false;
+
+                memset(output + pixel, *frame++, count);
+
+                pixel += count;
+            }
+            else{
+                uint32_t count = token - 0xC0 + 1;
+
+                if (isKeyFrame || count > pixelCount - pixel) return false;
+
+                pixel += count;
+            }
+        }
+
+        return pixel >= pixelCount;
+    }
+
+    CompressedImageSequence(Image* image, const uint8_t* frames, const uint32_t* frameOffsets, unsigned int imageCount, float fps){
+        this->startTime = FrameContext::GetCurrentMillis();
+        this->image = image;
+        this->frames = frames;
+        this->frameOffsets = frameOffsets;
+        this->imageCount = imageCount;
+        this->fps = fps;
+        this->frameTime = ((float)imageCount) / fps;
+    }
+
+    ~CompressedImageSequence(){
+        delete[] frameBuffer;
+    }
+
+    void SetFPS(float fps){
+        this->fps = fps;
+    }
+
+    void SetSize(Vector2D size){
+        image->SetSize(size);
+    }
+
+    void SetPosition(Vector2D offset){
+        image->SetPosition(offset);
+    }
+
+    void SetRotation(float angle){
+        image->SetRotation(angle);
+    }
+
+    void SetHueAngle(float hueAngle){
+        image->SetHueAngle(hueAngle);
+    }
+
+    void Reset(){
+        startTime = FrameContext::GetCurrentMillis();
+    }
+
+    //microseconds spent decoding in the last frame change, including any frames skipped over
+    uint32_t GetDecodeTime(){
+        return decodeTime;
+    }
+
+    //true once a malformed frame was found, the frames depending on it show the last good frame instead
+    bool HasFailed(){
+        return failed;
+    }
+
+    unsigned int GetFailedFrame(){
+        return failedFrame;
+    }
+
+    void Update(){
+        Update(FrameContext::GetActive());
+    }
+
+    void Update(FrameContext* frame){
+        unsigned long currentMillis = frame ? frame->GetMillis() : millis();
+        float currentTime = fmod((currentMillis - startTime) / 1000.0f, frameTime) / frameTime;//normalize time to ratio
+
+        Seek((unsigned int)Mathematics::Map(currentTime, 0.0f, 1.0f, 0.0f, float(imageCount - 1)));
+    }
+
+    RGBColor GetRGB(Vector3D intersection, Vector3D normal, Vector3D uvw){
+        if (!decoded) Seek(0);
+
+        return image->GetRGB(intersection, normal, uvw);
+    }
+};
@@ -3,6 +3,7 @@
 #include "Arduino.h"
 #include "..\Materials\Image.h"
 #include "..\Materials\Material.h"
+#include "..\..\..\..\Utils\Time\FrameContext.h"
 
 class ImageSequence : public Material{
 private:
@@ -16,7 +17,7 @@ private:
 
 protected:
     ImageSequence(Image* image, const uint8_t** data, unsigned int imageCount, float fps){
-        this->startTime = millis();
+        this->startTime = FrameContext::GetCurrentMillis();
         this->image = image;
         this->data = data;
         this->imageCount = imageCount;
@@ -46,11 +47,16 @@ public:
     }
 
     void Reset(){
-        startTime = millis();
+        startTime = FrameContext::GetCurrentMillis();
     }
 
     void Update(){
-        float currentTime = fmod((millis() - startTime) / 1000.0f, frameTime) / frameTime;//normalize time to ratio
+        Update(FrameContext::GetActive());
+    }
+
+    void Update(FrameContext* frame){
+        unsigned long currentMillis = frame ? frame->GetMillis() : millis();
+        float currentTime = fmod((currentMillis - startTime) / 1000.0f, frameTime) / frameTime;//normalize time to ratio
 
         currentFrame = (unsigned int)Mathematics::Map(currentTime, 0.0f, 1.0f, 0.0f, float(imageCount - 1));
 
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Arduino.h"
+
+//Sequential file reader for streamed sequences, the SD slot on Teensy 3.6 and 4.1 and stdio on a desktop build for testing
+#if defined(ARDUINO_TEENSY41) || defined(ARDUINO_TEENSY36)
+#include <SD.h>
+#define SEQUENCEFILE_SD
+#elif !defined(ARDUINO)
+#include <stdio.h>
+#define SEQUENCEFILE_STDIO
+#endif
+
+class SequenceFile {
+private:
+#if defined(SEQUENCEFILE_SD)
+    File file;
+
+    static bool BeginCard(){
+        static bool started = false;
+
+        if (!started) started = SD.begin(BUILTIN_SDCARD);
+
+        return started;
+    }
+#elif defined(SEQUENCEFILE_STDIO)
+    FILE* file = nullptr;
+#endif
+
+public:
+    SequenceFile(){}
+
+    ~SequenceFile(){
+        Close();
+    }
+
+    SequenceFile(const SequenceFile&) = delete;
+    SequenceFile& operator=(const SequenceFile&) = delete;
+
+    bool Open(const char* path){
+        Close();
+
+#if defined(SEQUENCEFILE_SD)
+        if (!BeginCard()) return false;
+
+        file = SD.open(path, FILE_READ);
+
+        return bool(file);
+#elif defined(SEQUENCEFILE_STDIO)
+        file = fopen(path, "rb");
+
+        return file != nullptr;
+#else
+        return false;//no file system on this target
+#endif
+    }
+
+    void Close(){
+#if defined(SEQUENCEFILE_SD)
+        if (file) file.close();
+#elif defined(SEQUENCEFILE_STDIO)
+        if (file) fclose(file);
+
+        file = nullptr;
+#endif
+    }
+
+    bool IsOpen(){
+#if defined(SEQUENCEFILE_SD)
+        return bool(file);
+#elif defined(SEQUENCEFILE_STDIO)
+        return file != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    bool Seek(uint32_t position){
+#if defined(SEQUENCEFILE_SD)
+        return file && file.seek(position);
+#elif defined(SEQUENCEFILE_STDIO)
+        return file && fseek(file, long(position), SEEK_SET) == 0;
+#else
+        return false;
+#endif
+    }
+
+    //returns the bytes read, 0 at the end of the file or on an error
+    uint32_t Read(uint8_t* buffer, uint32_t length){
+#if defined(SEQUENCEFILE_SD)
+        if (!file) return 0;
+
+        int count = file.read(buffer, length);
+
+        return count > 0 ? uint32_t(count) : 0;
+#elif defined(SEQUENCEFILE_STDIO)
+        return file ? uint32_t(fread(buffer, 1, length, file)) : 0;
+#else
+        return 0;
+#endif
+    }
+};
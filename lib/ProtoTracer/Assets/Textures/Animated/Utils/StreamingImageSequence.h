@@ -0,0 +1,372 @@
+#pragma once
+
+#include "Arduino.h"
+#include "CompressedImageSequence.h"
+#include "SequenceFile.h"
+
+//Image sequence played from a file instead of flash, written by tools/ImageSequenceEncoder.py --stream
+//frames are compressed the same as CompressedImageSequence and read ahead into two chunk slots, each Update reads at most
+//the prefetch budget so the next frame loads over the frames before it is shown, a frame that is due but not loaded yet
+//keeps the current one on screen and counts as a stall instead of blocking the render loop, when playback falls further
+//behind than the slots hold it skips ahead to the last keyframe at or before the due frame
+//
+//file, little endian: "PTSQ", version, reserved, width u16, height u16, palette bytes u16, frames u32, largest chunk u32,
+//fps float, the palette, then one chunk per frame: length u32 and the frame tokens, after the last frame playback loops
+class StreamingImageSequence : public Material {
+public:
+    static const uint8_t version = 1;
+    static const uint8_t headerSize = 24;
+    static const uint8_t slotCount = 2;
+
+private:
+    struct ChunkSlot {
+        uint8_t* data = nullptr;
+        uint8_t header[4];
+        uint32_t length = 0;
+        uint32_t loaded = 0;//header bytes included
+        uint32_t frame = 0;
+        bool ready = false;
+    };
+
+    SequenceFile file;
+    const char* path;
+    Image* image = nullptr;
+    uint8_t* palette = nullptr;
+    uint8_t* frameBuffer = nullptr;
+    ChunkSlot slots[slotCount];
+    uint8_t loadSlot = 0;
+    uint8_t decodeSlot = 0;
+
+    uint16_t width = 0;
+    uint16_t height = 0;
+    uint32_t frameCount = 0;
+    uint32_t maxChunk = 0;
+    uint32_t dataStart = 0;//first chunk, where playback loops back to
+    uint32_t nextFrame = 0;//next frame read from the file
+    uint32_t chunkStart = 0;//file position of the chunk of nextFrame
+    unsigned int currentFrame = 0;
+
+    unsigned long startTime = 0;
+    float fps = 0.0f;//0 plays at the rate stored in the file
+    float fileFPS = 24.0f;
+    uint32_t prefetchBudget = 8192;
+    uint32_t stalls = 0;
+    uint32_t readTime = 0;
+    uint32_t decodeTime = 0;
+    bool failed = false;
+
+    //kept until the image exists
+    Vector2D size = Vector2D(1.0f, 1.0f);
+    Vector2D offset;
+    float angle = 0.0f;
+    float hueAngle = 0.0f;
+
+    static uint16_t ReadU16(const uint8_t* data){
+        return uint16_t(data[0] | (data[1] << 8));
+    }
+
+    static uint32_t ReadU32(const uint8_t* data){
+        return uint32_t(data[0]) | (uint32_t(data[1]) << 8) | (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24);
+    }
+
+    bool ReadHeader(){
+        uint8_t header[headerSize];
+
+        if (file.Read(header, headerSize) != headerSize) return false;
+        if (memcmp(header, "PTSQ", 4) != 0 || header[4] != version) return false;
+
+        width = ReadU16(header + 6);
+        height = ReadU16(header + 8);
+
+        uint16_t paletteSize = ReadU16(header + 10);
+
+        frameCount = ReadU32(header + 12);
+        maxChunk = ReadU32(header + 16);
+
+        memcpy(&fileFPS, header + 20, sizeof(float));
+
+        if (width == 0 || height == 0 || frameCount == 0 || maxChunk == 0) return false;
+
+        palette = new uint8_t[paletteSize > 0 ? paletteSize : 1];
+
+        if (file.Read(palette, paletteSize) != paletteSize) return false;
+
+        dataStart = headerSize + paletteSize;
+        chunkStart = dataStart;
+
+        frameBuffer = new uint8_t[width * height];
+
+        memset(frameBuffer, 0, width * height);
+
+        for (uint8_t i = 0; i < slotCount; i++){
+            slots[i].data = new uint8_t[maxChunk];
+        }
+
+        image = new Image(frameBuffer, palette, width, height, paletteSize > 255 ? 0 : paletteSize);//8 bit palette size, 0 reads all 256 colors
+
+        image->SetSize(size);
+        image->SetPosition(offset);
+        image->SetRotation(angle);
+        image->SetHueAngle(hueAngle);
+
+        return true;
+    }
+
+    //reads up to budget bytes into the slots in order and takes them off the budget, returns false on a read error
+    bool Prefetch(uint32_t& budget){
+        while (budget > 0){
+            ChunkSlot& slot = slots[loadSlot];
+
+            if (slot.ready) return true;//both slots are full
+
+            if (slot.loaded < 4){
+                uint32_t count = file.Read(slot.header + slot.loaded, 4 - slot.loaded);
+
+                if (count == 0) return false;
+
+                slot.loaded += count;
+                budget = count < budget ? budget - count : 0;
+
+                if (slot.loaded < 4) continue;
+
+                slot.length = ReadU32(slot.header);
+
+                if (slot.length == 0 || slot.length > maxChunk) return false;
+
+                if (budget == 0) break;
+            }
+
+            uint32_t remaining = slot.length - (slot.loaded - 4);
+            uint32_t count = file.Read(slot.data + slot.loaded - 4, remaining < budget ? remaining : budget);
+
+            if (count == 0) return false;
+
+            slot.loaded += count;
+            budget -= count;
+
+            if (slot.loaded - 4 < slot.length) continue;
+
+            slot.frame = nextFrame;
+            slot.ready = true;
+            loadSlot = (loadSlot + 1) % slotCount;
+            chunkStart += 4 + slot.length;
+
+            if (++nextFrame >= frameCount){//loop, the first frame is always a keyframe
+                nextFrame = 0;
+                chunkStart = dataStart;
+
+                if (!file.Seek(dataStart)) return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool DecodeNext(){
+        ChunkSlot& slot = slots[decodeSlot];
+
+        if (!slot.ready) return false;
+
+        uint32_t start = micros();
+
+        bool valid = CompressedImageSequence::DecodeFrame(slot.data, slot.length, frameBuffer, uint32_t(width) * height);
+
+        decodeTime += micros() - start;
+
+        if (!valid){//malformed chunk, the buffer is half written and the frames after it depend on it
+            failed = true;
+
+            return false;
+        }
+
+        currentFrame = slot.frame;
+        slot.ready = false;
+        slot.loaded = 0;
+        decodeSlot = (decodeSlot + 1) % slotCount;
+
+        return true;
+    }
+
+    uint32_t FramesBehind(unsigned int target){
+        return (target + frameCount - currentFrame) % frameCount;
+    }
+
+    //walks the chunk headers from nextFrame to the target and moves the read position to the last keyframe among them,
+    //the slots are dropped when it moves, only the 5 header bytes of each chunk are read, returns false on a read error
+    bool Resync(unsigned int target, uint32_t& budget){
+        uint32_t resume = chunkStart + (slots[loadSlot].ready ? 0 : slots[loadSlot].loaded);
+        uint32_t chunks = (target + frameCount - nextFrame) % frameCount + 1;
+        uint32_t frame = nextFrame;
+        uint32_t position = chunkStart;
+        uint32_t keyFrame = nextFrame;
+        uint32_t keyPosition = chunkStart;
+
+        for (uint32_t i = 0; i < chunks; i++){
+            uint8_t header[5];//length and frame type
+
+            if (!file.Seek(position) || file.Read(header, 5) != 5) return false;
+
+            uint32_t length = ReadU32(header);
+
+            if (length == 0 || length > maxChunk) return false;
+
+            if (header[4] == CompressedImageSequence::keyFrame){
+                keyFrame = frame;
+                keyPosition = position;
+            }
+
+            budget = budget > 5 ? budget - 5 : 0;
+            position += 4 + length;
+
+            if (++frame >= frameCount){
+                frame = 0;
+                position = dataStart;
+            }
+        }
+
+        if (keyFrame == nextFrame) return file.Seek(resume);//no keyframe past the one loading, keep reading in order
+
+        for (uint8_t i = 0; i < slotCount; i++){
+            slots[i].ready = false;
+            slots[i].loaded = 0;
+        }
+
+        loadSlot = 0;
+        decodeSlot = 0;
+        nextFrame = keyFrame;
+        chunkStart = keyPosition;
+
+        return file.Seek(keyPosition);
+    }
+
+public:
+    StreamingImageSequence(const char* path, Vector2D size, Vector2D offset, float fps = 0.0f){
+        this->path = path;
+        this->size = size;
+        this->offset = offset;
+        this->fps = fps;
+    }
+
+    ~StreamingImageSequence(){
+        delete image;
+        delete[] palette;
+        delete[] frameBuffer;
+
+        for (uint8_t i = 0; i < slotCount; i++){
+            delete[] slots[i].data;
+        }
+    }
+
+    //opens the file and shows the first frame, call from setup once the card is available, blocks for the first frame only
+    bool Begin(){
+        if (image || failed) return IsPlaying();//opened once, a failed card needs a restart
+
+        failed = !file.Open(path) || !ReadHeader();
+
+        uint32_t budget = maxChunk + 4;
+
+        if (!failed) failed = !Prefetch(budget) || !DecodeNext();
+
+        Reset();
+
+        return !failed;
+    }
+
+    bool IsPlaying(){
+        return image && !failed;
+    }
+
+    void SetFPS(float fps){
+        this->fps = fps;
+    }
+
+    //bytes read from the file per Update, SD on a Teensy 4.1 reads roughly 20 kB per ms
+    void SetPrefetchBudget(uint32_t prefetchBudget){
+        this->prefetchBudget = prefetchBudget;
+    }
+
+    void SetSize(Vector2D size){
+        this->size = size;
+
+        if (image) image->SetSize(size);
+    }
+
+    void SetPosition(Vector2D offset){
+        this->offset = offset;
+
+        if (image) image->SetPosition(offset);
+    }
+
+    void SetRotation(float angle){
+        this->angle = angle;
+
+        if (image) image->SetRotation(angle);
+    }
+
+    void SetHueAngle(float hueAngle){
+        this->hueAngle = hueAngle;
+
+        if (image) image->SetHueAngle(hueAngle);
+    }
+
+    Image* GetImage(){
+        return image;
+    }
+
+    void Reset(){
+        startTime = FrameContext::GetCurrentMillis();
+    }
+
+    //frames the clock was ahead of the shown frame, summed over every Update
+    uint32_t GetStallCount(){
+        return stalls;
+    }
+
+    //microseconds spent in the last Update reading the file, GetDecodeTime holds the decoding
+    uint32_t GetReadTime(){
+        return readTime;
+    }
+
+    uint32_t GetDecodeTime(){
+        return decodeTime;
+    }
+
+    void Update(){
+        Update(FrameContext::GetActive());
+    }
+
+    void Update(FrameContext* frame){
+        if (!IsPlaying()) return;
+
+        unsigned long currentMillis = frame ? frame->GetMillis() : millis();
+        float rate = fps > 0.0f ? fps : fileFPS;
+        unsigned int target = (unsigned int)(float(currentMillis - startTime) / 1000.0f * rate) % frameCount;
+
+        uint32_t budget = prefetchBudget;
+        uint32_t start = micros();
+        bool decodedFrame = false;
+
+        decodeTime = 0;
+
+        if (FramesBehind(target) > slotCount && !Resync(target, budget)) failed = true;
+
+        //frames only play forward, the chunks up to the due frame are read and decoded within the budget
+        while (!failed && currentFrame != target){
+            if (DecodeNext()) decodedFrame = true;
+            else if (failed || budget == 0) break;
+            else if (!Prefetch(budget)) failed = true;
+        }
+
+        if (decodedFrame) image->GetTexture()->Invalidate();//same buffer with new contents
+
+        if (!failed) stalls += FramesBehind(target);
+
+        if (!failed && !Prefetch(budget)) failed = true;//read ahead with what is left
+
+        readTime = micros() - start - decodeTime;
+    }
+
+    RGBColor GetRGB(Vector3D intersection, Vector3D normal, Vector3D uvw){
+        return image ? image->GetRGB(intersection, normal, uvw) : RGBColor();
+    }
+};
@@ -8,9 +8,12 @@ private:
 	static const uint8_t rgbColors[];
 
 public:
-	CoelaCant(Vector2D size, Vector2D offset) : Image(rgbMemory, rgbColors, 200, 145, 768) {
+	//200 by 145 pixels is finer than the panels, pass the pixel group pitch to sample a matching mip level instead of
+	//aliasing on level 0, or call SetPixelSpacing(pixelGroup) once the camera is known
+	CoelaCant(Vector2D size, Vector2D offset, float pixelSpacing = 0.0f) : Image(rgbMemory, rgbColors, 200, 145, 768) {
 		SetSize(size);
 		SetPosition(offset);
+		SetPixelSpacing(pixelSpacing);
 	}
 };
 
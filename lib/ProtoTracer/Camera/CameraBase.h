@@ -4,6 +4,16 @@
 
 class CameraBase {
 protected:
+    uint8_t priority = 0;//0 is the highest priority, always rendered
+    float targetRate = 0.0f;//Hz, 0 renders every frame
+    uint8_t maxFrameSkip = 0;//forces a render after this many frames skipped for budget, 0 disables
+    uint8_t framesSkipped = 0;
+
+    uint32_t lastRenderTime = 0;//micros
+    float renderDuration = 0.0f;//micros, averaged
+    float achievedRate = 0.0f;//Hz, averaged
+    bool hasRendered = false;
+    bool dynamicLOD = false;
 
 public:
     CameraBase() {}
@@ -11,4 +21,79 @@ public:
     virtual Vector2D GetCameraCenterCoordinate() = 0;
 
     virtual IPixelGroup* GetPixelGroup() = 0;
+
+    void SetPriority(uint8_t priority){
+        this->priority = priority;
+    }
+
+    uint8_t GetPriority(){
+        return priority;
+    }
+
+    void SetTargetRate(float targetRate){
+        this->targetRate = targetRate;
+    }
+
+    float GetTargetRate(){
+        return targetRate;
+    }
+
+    void SetMaxFrameSkip(uint8_t maxFrameSkip){
+        this->maxFrameSkip = maxFrameSkip;
+    }
+
+    bool IsDue(uint32_t currentTime){
+        if (targetRate <= 0.0f || !hasRendered) return true;
+
+        return float(currentTime - lastRenderTime) >= 1000000.0f / targetRate;
+    }
+
+    bool IsSkipLimitReached(){
+        return maxFrameSkip > 0 && framesSkipped >= maxFrameSkip;
+    }
+
+    void MarkSkipped(){
+        if (framesSkipped < 255) framesSkipped++;
+    }
+
+    void MarkRendered(uint32_t startTime, uint32_t endTime){
+        float duration = float(endTime - startTime);
+
+        if (hasRendered){
+            float interval = float(startTime - lastRenderTime);
+
+            if (interval > 0.0f) achievedRate = achievedRate * 0.9f + (1000000.0f / interval) * 0.1f;
+
+            renderDuration = renderDuration * 0.9f + duration * 0.1f;
+        }
+        else{
+            renderDuration = duration;
+        }
+
+        lastRenderTime = startTime;
+        framesSkipped = 0;
+        hasRendered = true;
+    }
+
+    float GetRenderDuration(){
+        return renderDuration;
+    }
+
+    float GetAchievedRate(){
+        return achievedRate;
+    }
+
+    uint8_t GetFramesSkipped(){
+        return framesSkipped;
+    }
+
+    void SetDynamicLOD(bool dynamicLOD){
+        this->dynamicLOD = dynamicLOD;
+
+        if (!dynamicLOD) GetPixelGroup()->SetSampleMode(IPixelGroup::Full);
+    }
+
+    bool UseDynamicLOD(){
+        return dynamicLOD;
+    }
 };
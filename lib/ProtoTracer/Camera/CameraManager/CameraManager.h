@@ -21,4 +21,19 @@ public:
         return count;
     }
 
+    //lower priority cameras are rendered at their target rate when the engine frame budget allows
+    void SetCameraSchedule(uint8_t index, uint8_t priority, float targetRate, uint8_t maxFrameSkip = 0) {
+        cameras[index]->SetPriority(priority);
+        cameras[index]->SetTargetRate(targetRate);
+        cameras[index]->SetMaxFrameSkip(maxFrameSkip);
+    }
+
+    float GetAchievedRate(uint8_t index) {
+        return cameras[index]->GetAchievedRate();
+    }
+
+    float GetRenderDuration(uint8_t index) {
+        return cameras[index]->GetRenderDuration();
+    }
+
 };
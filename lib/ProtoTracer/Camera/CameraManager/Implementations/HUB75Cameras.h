@@ -3,7 +3,7 @@
 #include "..\CameraManager.h"
 #include "..\..\Camera.h"
 #include "..\..\Pixels\PixelGroup.h"
-#include "..\..\Pixels\PixelGroups\P3HUB75.h"
+#include "..\..\Pixels\PixelGroups\P3HUB75Map.h"
 #include "..\..\..\Utils\Math\Transform.h"
 
 class HUB75DeltaCameraManager : public CameraManager {
@@ -17,7 +17,7 @@ public:
     HUB75DeltaCameraManager() 
         : cameraLayout(CameraLayout::ZForward, CameraLayout::YUp),
           camTransform(Vector3D(), Vector3D(0, 0, -500.0f), Vector3D(1, 1, 1)),
-          camPixels(P3HUB75),
+          camPixels(&P3HUB75Map),
           camMain(&camTransform, &cameraLayout, &camPixels),
           CameraManager(new CameraBase*[1]{ &camMain }, 1) {
     }
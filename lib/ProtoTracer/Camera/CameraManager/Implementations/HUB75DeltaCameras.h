@@ -3,7 +3,7 @@
 #include "..\CameraManager.h"
 #include "..\..\Camera.h"
 #include "..\..\Pixels\PixelGroup.h"
-#include "..\..\Pixels\PixelGroups\P3HUB75.h"
+#include "..\..\Pixels\PixelGroups\P3HUB75Map.h"
 #include "..\..\Pixels\PixelGroups\DeltaDisplay.h"
 #include "..\..\..\Utils\Math\Transform.h"
 
@@ -22,10 +22,11 @@ public:
         : cameraLayout(CameraLayout::ZForward, CameraLayout::YUp),
           camTransform(Vector3D(), Vector3D(0, 0, -500.0f), Vector3D(1, 1, 1)),
           camSideTransform(Vector3D(), Vector3D(204.0f, 0, -500.0f), Vector3D(1, 1, 1)),
-          camPixels(P3HUB75),
+          camPixels(&P3HUB75Map),
           camSidePixels(DeltaDisplay),
           camMain(&camTransform, &cameraLayout, &camPixels),
           camSidePanels(&camSideTransform, &cameraLayout, &camSidePixels),
           CameraManager(new CameraBase*[2]{ &camMain, &camSidePanels }, 2) {
+        SetCameraSchedule(1, 1, 30.0f, 4);//side strips show slow gradients, keep the face at a steady rate
     }
 };
@@ -3,7 +3,7 @@
 #include "..\CameraManager.h"
 #include "..\..\Camera.h"
 #include "..\..\Pixels\PixelGroup.h"
-#include "..\..\Pixels\PixelGroups\P3HUB75.h"
+#include "..\..\Pixels\PixelGroups\P3HUB75Map.h"
 #include "..\..\..\Utils\Math\Transform.h"
 
 class DualP3HUB75CameraManager : public CameraManager {
@@ -21,8 +21,8 @@ public:
         : cameraLayout(CameraLayout::ZForward, CameraLayout::YUp),
           camTransform1(Vector3D(), Vector3D(0, 0.0f, -500.0f), Vector3D(1, 1, 1)),
           camTransform2(Vector3D(), Vector3D(0, 0.0f, -500.0f), Vector3D(1, 1, 1)),
-          camPixelsLeft(P3HUB75),
-          camPixelsRight(P3HUB75),
+          camPixelsLeft(&P3HUB75Map),
+          camPixelsRight(&P3HUB75Map),
           camLeft(&camTransform1, &cameraLayout, &camPixelsLeft),
           camRight(&camTransform2, &cameraLayout, &camPixelsRight),
           CameraManager(new CameraBase*[2]{ &camLeft, &camRight }, 2) {
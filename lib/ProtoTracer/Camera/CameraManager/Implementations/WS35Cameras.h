@@ -3,7 +3,7 @@
 #include "..\CameraManager.h"
 #include "..\..\Camera.h"
 #include "..\..\Pixels\PixelGroup.h"
-#include "..\..\Pixels\PixelGroups\WS35Pixels.h"
+#include "..\..\Pixels\PixelGroups\WS35PixelsMap.h"
 #include "..\..\..\Utils\Math\Transform.h"
 
 class WS35CameraManager : public CameraManager {
@@ -17,7 +17,7 @@ public:
     WS35CameraManager() 
         : cameraLayout(CameraLayout::ZForward, CameraLayout::YUp),
           camTransform(Vector3D(), Vector3D(0, 0, -500.0f), Vector3D(1, 1, 1)),
-          camPixels(WS35Pixels, IPixelGroup::ZEROTOMAX),
+          camPixels(&WS35PixelsMap, IPixelGroup::ZEROTOMAX),
           cam(&camTransform, &cameraLayout, &camPixels),
           CameraManager(new CameraBase*[1]{ &camRght }, 1) {
     }
@@ -3,7 +3,7 @@
 #include "..\CameraManager.h"
 #include "..\..\Camera.h"
 #include "..\..\Pixels\PixelGroup.h"
-#include "..\..\Pixels\PixelGroups\WS35Pixels.h"
+#include "..\..\Pixels\PixelGroups\WS35PixelsMap.h"
 #include "..\..\..\Utils\Math\Transform.h"
 
 class WS35SplitCameraManager : public CameraManager {
@@ -21,8 +21,8 @@ public:
         : cameraLayout(CameraLayout::ZForward, CameraLayout::YUp),
           camRghtTransform(Vector3D(), Vector3D(0, 0, -500.0f), Vector3D(1, 1, 1)),
           camLeftTransform(Vector3D(), Vector3D(0, 0, -500.0f), Vector3D(1, 1, 1)),
-          camRghtPixels(WS35Pixels, IPixelGroup::ZEROTOMAX),
-          camLeftPixels(WS35Pixels, IPixelGroup::MAXTOZERO),
+          camRghtPixels(&WS35PixelsMap, IPixelGroup::ZEROTOMAX),
+          camLeftPixels(&WS35PixelsMap, IPixelGroup::MAXTOZERO),
           camRght(&camRghtTransform, &cameraLayout, &camRghtPixels),
           camLeft(&camLeftTransform, &cameraLayout, &camLeftPixels),
           CameraManager(new CameraBase*[2]{ &camRght, &camLeft }, 2) {
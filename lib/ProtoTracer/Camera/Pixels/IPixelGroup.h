@@ -10,13 +10,20 @@ public:
         MAXTOZERO
     };
 
+    enum SampleMode{
+        Full,
+        Checkerboard,//every other pixel, half the samples
+        Quarter//every other pixel on every other row
+    };
+
     virtual Vector2D GetCenterCoordinate() = 0;
     virtual Vector2D GetSize() = 0;
     virtual Vector2D GetCoordinate(unsigned int count) = 0;
     virtual int GetPixelIndex(Vector2D location) = 0;
     virtual RGBColor* GetColor(unsigned int count) = 0;
-    virtual RGBColor* GetColors() = 0;
+    virtual RGBColor* GetColors() = 0;//nullptr for groups without color buffers of their own, effects are skipped on those
     virtual RGBColor* GetColorBuffer() = 0;
+    virtual void SwapBuffers() = 0;
     virtual unsigned int GetPixelCount() = 0;
     virtual bool Overlaps(BoundingBox2D* box) = 0;
     virtual bool ContainsVector2D(Vector2D v) = 0;
@@ -31,4 +38,8 @@ public:
     virtual bool GetOffsetXYIndex(unsigned int count, unsigned int* index, int x1, int y1) = 0;
     virtual bool GetRadialIndex(unsigned int count, unsigned int* index, int pixels, float angle) = 0;
     virtual void GridSort() = 0;
+    virtual void SetSampleMode(SampleMode sampleMode) = 0;
+    virtual SampleMode GetSampleMode() = 0;
+    virtual bool IsSampled(unsigned int count) = 0;
+    virtual void Upscale() = 0;
 };
@@ -1,15 +1,19 @@
 #pragma once
 
 #include "IPixelGroup.h"
+#include "PixelMap.h"
 
 template<size_t pixelCount>
 class PixelGroup : public IPixelGroup{
 private:
     Direction direction;
     BoundingBox2D bounds;
-	Vector2D* pixelPositions;
-  	RGBColor pixelColors[pixelCount];
-  	RGBColor pixelBuffer[pixelCount];
+	Vector2D* pixelPositions = nullptr;
+    PixelMap* pixelMap = nullptr;
+  	RGBColor colorsA[pixelCount];
+  	RGBColor colorsB[pixelCount];
+    RGBColor* pixelColors = colorsA;
+    RGBColor* pixelBuffer = colorsB;
     unsigned int up[pixelCount];
     unsigned int down[pixelCount];
     unsigned int left[pixelCount];
@@ -25,6 +29,78 @@ private:
     Vector2D size;
     Vector2D position;
 
+    SampleMode sampleMode = Full;
+    uint8_t* sampleParity = nullptr;//bit 0 X parity, bit 1 Y parity, only used by irregular layouts
+
+    bool GetNeighborIndex(unsigned int count, uint8_t direction, unsigned int* index){//0 right, 1 left, 2 up, 3 down
+        if (direction == 0) return GetRightIndex(count, index);
+        else if (direction == 1) return GetLeftIndex(count, index);
+        else if (direction == 2) return GetUpIndex(count, index);
+        else return GetDownIndex(count, index);
+    }
+
+    bool GetOffsetGridIndex(unsigned int count, unsigned int* index, int x1, int y1){//constant time offset for rectangular groups
+        int x = int(count % rowCount) + x1;
+        int y = int(count / rowCount) + y1;
+
+        if (x < 0 || x >= rowCount || y < 0 || y >= colCount) return false;
+
+        *index = unsigned(y) * rowCount + unsigned(x);
+
+        return true;
+    }
+
+    //assigns grid parity by walking the neighbor links, so irregular layouts decimate like a grid
+    void CalculateSampleParity(){
+        const uint8_t visited = 0x04;
+        unsigned int* queue = new unsigned int[pixelCount];
+
+        sampleParity = new uint8_t[pixelCount];
+
+        for(unsigned int i = 0; i < pixelCount; i++){
+            sampleParity[i] = 0;
+        }
+
+        for(unsigned int start = 0; start < pixelCount; start++){
+            if (sampleParity[start] & visited) continue;
+
+            unsigned int head = 0, tail = 0;
+
+            sampleParity[start] = visited;
+            queue[tail++] = start;
+
+            while (head < tail){
+                unsigned int current = queue[head++];
+                unsigned int neighbor;
+
+                for(uint8_t d = 0; d < 4; d++){
+                    if (!GetNeighborIndex(current, d, &neighbor) || (sampleParity[neighbor] & visited)) continue;
+
+                    sampleParity[neighbor] = (sampleParity[current] ^ (d < 2 ? 0x01 : 0x02)) | visited;
+                    queue[tail++] = neighbor;
+                }
+            }
+        }
+
+        delete[] queue;
+    }
+
+    uint8_t CountSampledNeighbors(unsigned int count, uint16_t* r, uint16_t* g, uint16_t* b){
+        uint8_t found = 0;
+        unsigned int neighbor;
+
+        for(uint8_t d = 0; d < 4; d++){
+            if (GetNeighborIndex(count, d, &neighbor) && IsSampled(neighbor)){
+                *r += pixelColors[neighbor].R;
+                *g += pixelColors[neighbor].G;
+                *b += pixelColors[neighbor].B;
+                found++;
+            }
+        }
+
+        return found;
+    }
+
 public:
     PixelGroup(Vector2D size, Vector2D position, uint16_t rowCount){
         this->size = size;
@@ -55,7 +131,48 @@ public:
         //ListPixelNeighbors();
     }
 
-    ~PixelGroup(){}
+    PixelGroup(PixelMap* pixelMap, Direction direction = ZEROTOMAX){
+        this->direction = direction;
+
+        if (pixelMap->IsRectangular() && direction == ZEROTOMAX){//grid math assumes the first pixel at the minimum corner
+            rowCount = pixelMap->GetRowCount();
+            colCount = pixelCount / rowCount;
+
+            Vector2D pitch = pixelMap->GetMaximum() - pixelMap->GetMinimum();
+            pitch.X = rowCount > 1 ? pitch.X / float(rowCount - 1) : 0.0f;
+            pitch.Y = colCount > 1 ? pitch.Y / float(colCount - 1) : 0.0f;
+
+            size = Vector2D(pitch.X * float(rowCount), pitch.Y * float(colCount));
+            position = pixelMap->GetMinimum() + size / 2.0f;
+
+            isRectangular = true;
+        }
+        else{
+            this->pixelMap = pixelMap;
+
+            //neighbor tables are precomputed by the importer (or computed for a reversed grid), only the index order follows the direction
+            for(unsigned int i = 0; i < pixelCount; i++){
+                unsigned int mapIndex = direction == ZEROTOMAX ? i : pixelCount - i - 1;
+
+                SetNeighbor(pixelMap->GetUpIndex(mapIndex), &up[i], &upExists[i]);
+                SetNeighbor(pixelMap->GetDownIndex(mapIndex), &down[i], &downExists[i]);
+                SetNeighbor(pixelMap->GetLeftIndex(mapIndex), &left[i], &leftExists[i]);
+                SetNeighbor(pixelMap->GetRightIndex(mapIndex), &right[i], &rightExists[i]);
+            }
+        }
+
+        bounds.UpdateBounds(pixelMap->GetMinimum());
+        bounds.UpdateBounds(pixelMap->GetMaximum());
+
+        for(unsigned int i = 0; i < pixelCount; i++){
+            pixelColors[i] = RGBColor();
+            pixelBuffer[i] = RGBColor();
+        }
+    }
+
+    ~PixelGroup(){
+        delete[] sampleParity;
+    }
 
     virtual Vector2D GetCenterCoordinate(){
         return (bounds.GetMaximum() + bounds.GetMinimum()) / 2.0f;
@@ -79,6 +196,9 @@ public:
 
             return location;
         }
+        else if (pixelMap){
+            return pixelMap->GetCoordinate(direction == ZEROTOMAX ? count : pixelCount - count - 1);
+        }
         else{
             if(direction == ZEROTOMAX){
                 return pixelPositions[count];
@@ -90,16 +210,33 @@ public:
     }
 
     virtual int GetPixelIndex(Vector2D location) override {
-        float row = Mathematics::Map(location.X, position.X - size.X / 2.0f, position.X + size.X / 2.0f, 0.0f, float(rowCount));
-        float col = Mathematics::Map(location.Y, position.Y - size.Y / 2.0f, position.Y + size.Y / 2.0f, 0.0f, float(colCount));
-
-        unsigned int count = row + col * rowCount;
+        if (isRectangular){
+            int row = int(floorf(Mathematics::Map(location.X, position.X - size.X / 2.0f, position.X + size.X / 2.0f, 0.0f, float(rowCount)) + 0.5f));
+            int col = int(floorf(Mathematics::Map(location.Y, position.Y - size.Y / 2.0f, position.Y + size.Y / 2.0f, 0.0f, float(colCount)) + 0.5f));
 
-        if (count < pixelCount && count > 0 && row > 0 && row < rowCount && col > 0 && col < colCount){
-            return count;
+            if (row >= 0 && row < rowCount && col >= 0 && col < colCount){
+                return row + col * rowCount;
+            }
+            else{
+                return -1;
+            }
         }
-        else{
-            return -1;
+        else{//nearest pixel
+            if (!ContainsVector2D(location)) return -1;
+
+            int nearest = -1;
+            float nearestDistance = Mathematics::FLTMAX;
+
+            for (unsigned int i = 0; i < pixelCount; i++){
+                float distance = GetCoordinate(i).CalculateEuclideanDistance(location);
+
+                if (distance < nearestDistance){
+                    nearestDistance = distance;
+                    nearest = i;
+                }
+            }
+
+            return nearest;
         }
     }
 
@@ -115,6 +252,13 @@ public:
         return &pixelBuffer[0];
     }
 
+    virtual void SwapBuffers() override {
+        RGBColor* temp = pixelColors;
+
+        pixelColors = pixelBuffer;
+        pixelBuffer = temp;
+    }
+
     virtual unsigned int GetPixelCount() override {
         return pixelCount;
     }
@@ -146,10 +290,8 @@ public:
 
     virtual bool GetDownIndex(unsigned int count, unsigned int* downIndex) override {
         if (isRectangular){
-            unsigned int index = count - rowCount;
-
-            if (index > 0){
-                *downIndex = index;
+            if (count >= rowCount){
+                *downIndex = count - rowCount;
                 return true;
             }
             else{ return false; }
@@ -163,10 +305,8 @@ public:
 
     virtual bool GetLeftIndex(unsigned int count, unsigned int* leftIndex) override {
         if (isRectangular){
-            unsigned int index = count - 1;
-
-            if (!count % rowCount == 0 && count > 0){
-                *leftIndex = index;
+            if (count % rowCount != 0){
+                *leftIndex = count - 1;
                 return true;
             }
             else{ return false; }
@@ -182,7 +322,7 @@ public:
         if (isRectangular){
             unsigned int index = count + 1;
 
-            if (!count % rowCount + 1 == 0 && count < pixelCount){
+            if (index % rowCount != 0 && index < pixelCount){
                 *rightIndex = index;
                 return true;
             }
@@ -238,10 +378,12 @@ public:
     }
 
     virtual bool GetOffsetXIndex(unsigned int count, unsigned int* index, int x1) override {
+        if (isRectangular) return GetOffsetGridIndex(count, index, x1, 0);
+
         unsigned int tempIndex = count;
         bool valid = true;
 
-        for(int i = 0; i < x1; i++){
+        for(int i = 0; i < abs(x1); i++){
             if (x1 > 0) valid = GetRightIndex(tempIndex, &tempIndex);
             else if (x1 < 0) valid = GetLeftIndex(tempIndex, &tempIndex);
             else break;
@@ -255,10 +397,12 @@ public:
     }
 
     virtual bool GetOffsetYIndex(unsigned int count, unsigned int* index, int y1) override {
+        if (isRectangular) return GetOffsetGridIndex(count, index, 0, y1);
+
         unsigned int tempIndex = count;
         bool valid = true;
         
-        for(int i = 0; i < y1; i++){
+        for(int i = 0; i < abs(y1); i++){
             if (y1 > 0) valid = GetUpIndex(tempIndex, &tempIndex);
             else if (y1 < 0) valid = GetDownIndex(tempIndex, &tempIndex);
             else break;
@@ -272,18 +416,22 @@ public:
     }
 
     virtual bool GetOffsetXYIndex(unsigned int count, unsigned int* index, int x1, int y1) override {
+        if (isRectangular) return GetOffsetGridIndex(count, index, x1, y1);
+
         unsigned int tempIndex = count;
         bool valid = true;
 
-        for(int i = 0; i < fabs(x1); i++){
+        for(int i = 0; i < abs(x1); i++){
             if (x1 > 0) valid = GetRightIndex(tempIndex, &tempIndex);
             else if (x1 < 0) valid = GetLeftIndex(tempIndex, &tempIndex);
             else break;
             
             if (!valid) break;
         }
+
+        if (!valid) return false;
         
-        for(int i = 0; i < fabs(y1); i++){
+        for(int i = 0; i < abs(y1); i++){
             if (y1 > 0) valid = GetUpIndex(tempIndex, &tempIndex);
             else if (y1 < 0) valid = GetDownIndex(tempIndex, &tempIndex);
             else break;
@@ -339,7 +487,7 @@ public:
     }
 
     virtual void GridSort() override {
-        if(!isRectangular){
+        if(!isRectangular && pixelPositions){//flash maps carry the neighbor tables sorted by the importer
             // Loop through all pixels
             for (unsigned int i = 0; i < pixelCount; i++) {
                 Vector2D& currentPos = direction == ZEROTOMAX ? pixelPositions[i] : pixelPositions[pixelCount - i - 1];
@@ -407,6 +555,83 @@ public:
         //else do nothing
     }
 
+    virtual void SetSampleMode(SampleMode sampleMode) override {
+        if (sampleMode != Full && !isRectangular && !sampleParity) CalculateSampleParity();
+
+        this->sampleMode = sampleMode;
+    }
+
+    virtual SampleMode GetSampleMode() override {
+        return sampleMode;
+    }
+
+    virtual bool IsSampled(unsigned int count) override {
+        if (sampleMode == Full) return true;
+
+        uint8_t x, y;
+
+        if (isRectangular){
+            x = (count % rowCount) & 0x01;
+            y = (count / rowCount) & 0x01;
+        }
+        else{
+            x = sampleParity[count] & 0x01;
+            y = (sampleParity[count] >> 1) & 0x01;
+        }
+
+        if (sampleMode == Checkerboard) return x == y;
+        else return x == 0 && y == 0;
+    }
+
+    virtual void Upscale() override {//fills the pixels skipped by the sample mode from their rendered neighbors
+        if (sampleMode == Full) return;
+
+        //first pass fills pixels touching a sample, checkerboard is complete after this
+        for(unsigned int i = 0; i < pixelCount; i++){
+            if (IsSampled(i)) continue;
+
+            uint16_t r = 0, g = 0, b = 0;
+            uint8_t found = CountSampledNeighbors(i, &r, &g, &b);
+
+            if (found > 0) pixelColors[i] = RGBColor(r / found, g / found, b / found);
+        }
+
+        if (sampleMode != Quarter) return;
+
+        //second pass fills the diagonal gaps from the first pass results
+        for(unsigned int i = 0; i < pixelCount; i++){
+            if (IsSampled(i)) continue;
+
+            uint16_t r = 0, g = 0, b = 0;
+
+            if (CountSampledNeighbors(i, &r, &g, &b) > 0) continue;
+
+            uint8_t found = 0;
+            unsigned int neighbor;
+
+            for(uint8_t d = 0; d < 4; d++){
+                uint16_t nr = 0, ng = 0, nb = 0;
+
+                if (GetNeighborIndex(i, d, &neighbor) && CountSampledNeighbors(neighbor, &nr, &ng, &nb) > 0){
+                    r += pixelColors[neighbor].R;
+                    g += pixelColors[neighbor].G;
+                    b += pixelColors[neighbor].B;
+                    found++;
+                }
+            }
+
+            if (found > 0) pixelColors[i] = RGBColor(r / found, g / found, b / found);
+        }
+    }
+
+    void SetNeighbor(uint16_t mapIndex, unsigned int* index, bool* exists){
+        *exists = mapIndex != PixelMap::NoNeighbor;
+
+        if (*exists){
+            *index = direction == ZEROTOMAX ? mapIndex : pixelCount - mapIndex - 1;
+        }
+    }
+
     void ListPixelNeighbors(){
         for(unsigned int i = 0; i < pixelCount; i++){
             //Serial.print(i); Serial.print('\t');
@@ -0,0 +1,353 @@
+#pragma once
+
+#include "IPixelGroup.h"
+
+//Remaps another pixel group without copying its colors, so one render can be shown mirrored, rotated or cropped
+//Colors are read per pixel through GetColor, a view has no color buffers of its own: GetColors and GetColorBuffer return
+//nullptr and the engine skips effects on it, apply effects to the source group's camera instead
+class PixelGroupView : public IPixelGroup {
+public:
+    enum ViewType{
+        MirrorX,
+        MirrorY,
+        Rotate180
+    };
+
+private:
+    static const uint16_t NoPixel = 0xFFFF;
+
+    IPixelGroup* source;
+    unsigned int pixelCount;
+    uint16_t* layout = nullptr;//source pixel each view pixel sits on, nullptr when the view covers the whole source
+    uint16_t* inverse = nullptr;//source pixel to view pixel, only used with a layout
+    uint16_t* colorMap;//source pixel whose color is shown
+    RGBColor black;
+    BoundingBox2D bounds;
+
+    unsigned int GetLayoutIndex(unsigned int count){
+        return layout ? layout[count] : count;
+    }
+
+    bool ToViewIndex(unsigned int sourceIndex, unsigned int* index){
+        if (!layout){
+            *index = sourceIndex;
+            return true;
+        }
+
+        *index = inverse[sourceIndex];
+
+        return inverse[sourceIndex] != NoPixel;
+    }
+
+    void CalculateBounds(){
+        Vector2D first = source->GetCoordinate(GetLayoutIndex(0));
+
+        bounds = BoundingBox2D(first, first);
+
+        for (unsigned int i = 1; i < pixelCount; i++){
+            bounds.UpdateBounds(source->GetCoordinate(GetLayoutIndex(i)));
+        }
+    }
+
+    //nearest source pixel for each location through a coarse bucket grid, linear in the pixel count for any layout
+    void MapColors(const Vector2D* locations){
+        Vector2D minimum = bounds.GetMinimum();
+        Vector2D size = GetSize();
+        uint16_t cells = uint16_t(sqrtf(float(pixelCount))) + 1;
+        uint16_t cellsX = size.X > 0.0f ? cells : 1;
+        uint16_t cellsY = size.Y > 0.0f ? cells : 1;
+        float cellWidth = size.X > 0.0f ? size.X / float(cellsX) : 1.0f;
+        float cellHeight = size.Y > 0.0f ? size.Y / float(cellsY) : 1.0f;
+        float cellSize = cellWidth < cellHeight ? cellWidth : cellHeight;
+        float tolerance = sqrtf(cellWidth * cellHeight) / 2.0f;//about half a pixel pitch, cells hold about one pixel each
+        unsigned int* cellStart = new unsigned int[cellsX * cellsY + 1];
+        uint16_t* cellPixels = new uint16_t[pixelCount];
+        uint16_t* pixelCell = new uint16_t[pixelCount];
+
+        memset(cellStart, 0, sizeof(unsigned int) * (cellsX * cellsY + 1));
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            Vector2D coordinate = source->GetCoordinate(i);
+            int x = Mathematics::Constrain(int((coordinate.X - minimum.X) / cellWidth), 0, cellsX - 1);
+            int y = Mathematics::Constrain(int((coordinate.Y - minimum.Y) / cellHeight), 0, cellsY - 1);
+
+            pixelCell[i] = x + y * cellsX;
+            cellStart[pixelCell[i] + 1]++;
+        }
+
+        for (unsigned int i = 0; i < cellsX * cellsY; i++) cellStart[i + 1] += cellStart[i];
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            cellPixels[cellStart[pixelCell[i]]++] = i;
+        }
+
+        for (unsigned int i = cellsX * cellsY; i > 0; i--) cellStart[i] = cellStart[i - 1];//undo the fill offsets
+
+        cellStart[0] = 0;
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            Vector2D location = locations[i];
+
+            colorMap[i] = NoPixel;
+
+            if (location.X < minimum.X - tolerance || location.X > minimum.X + size.X + tolerance) continue;
+            if (location.Y < minimum.Y - tolerance || location.Y > minimum.Y + size.Y + tolerance) continue;
+
+            int cellX = Mathematics::Constrain(int((location.X - minimum.X) / cellWidth), 0, cellsX - 1);
+            int cellY = Mathematics::Constrain(int((location.Y - minimum.Y) / cellHeight), 0, cellsY - 1);
+            float nearestDistance = Mathematics::FLTMAX;
+
+            //rings of cells outward until no closer pixel can be left
+            for (int ring = 0; ring < cellsX + cellsY; ring++){
+                if (nearestDistance < float(ring - 1) * cellSize) break;
+
+                for (int y = cellY - ring; y <= cellY + ring; y++){
+                    if (y < 0 || y >= cellsY) continue;
+
+                    for (int x = cellX - ring; x <= cellX + ring; x++){
+                        if (x < 0 || x >= cellsX) continue;
+                        if (y != cellY - ring && y != cellY + ring && x != cellX - ring && x != cellX + ring) continue;//inner cells were searched
+
+                        unsigned int cell = x + y * cellsX;
+
+                        for (unsigned int j = cellStart[cell]; j < cellStart[cell + 1]; j++){
+                            float distance = source->GetCoordinate(cellPixels[j]).CalculateEuclideanDistance(location);
+
+                            if (distance < nearestDistance){
+                                nearestDistance = distance;
+                                colorMap[i] = cellPixels[j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        delete[] cellStart;
+        delete[] cellPixels;
+        delete[] pixelCell;
+    }
+
+public:
+    PixelGroupView(IPixelGroup* source, ViewType viewType) : source(source) {
+        pixelCount = source->GetPixelCount();
+        colorMap = new uint16_t[pixelCount];
+
+        CalculateBounds();
+
+        Vector2D center = GetCenterCoordinate();
+        Vector2D* locations = new Vector2D[pixelCount];
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            Vector2D location = source->GetCoordinate(i);
+
+            if (viewType == MirrorX || viewType == Rotate180) location.X = center.X * 2.0f - location.X;
+            if (viewType == MirrorY || viewType == Rotate180) location.Y = center.Y * 2.0f - location.Y;
+
+            locations[i] = location;
+        }
+
+        MapColors(locations);
+
+        delete[] locations;
+    }
+
+    //angle in degrees around the center of the source
+    PixelGroupView(IPixelGroup* source, float angle) : source(source) {
+        pixelCount = source->GetPixelCount();
+        colorMap = new uint16_t[pixelCount];
+
+        CalculateBounds();
+
+        Vector2D center = GetCenterCoordinate();
+        Vector2D* locations = new Vector2D[pixelCount];
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            locations[i] = source->GetCoordinate(i).Rotate(-angle, center);
+        }
+
+        MapColors(locations);
+
+        delete[] locations;
+    }
+
+    //only the source pixels inside the rectangle, in source order
+    PixelGroupView(IPixelGroup* source, Vector2D minimum, Vector2D maximum) : source(source) {
+        unsigned int sourceCount = source->GetPixelCount();
+
+        pixelCount = 0;
+        inverse = new uint16_t[sourceCount];
+
+        for (unsigned int i = 0; i < sourceCount; i++){
+            if (BoundingBox2D(minimum, maximum).Contains(source->GetCoordinate(i))){
+                inverse[i] = pixelCount++;
+            }
+            else{
+                inverse[i] = NoPixel;
+            }
+        }
+
+        layout = new uint16_t[pixelCount];
+        colorMap = new uint16_t[pixelCount];
+
+        for (unsigned int i = 0; i < sourceCount; i++){
+            if (inverse[i] != NoPixel){
+                layout[inverse[i]] = i;
+                colorMap[inverse[i]] = i;
+            }
+        }
+
+        if (pixelCount > 0) CalculateBounds();
+    }
+
+    ~PixelGroupView(){
+        delete[] layout;
+        delete[] inverse;
+        delete[] colorMap;
+    }
+
+    IPixelGroup* GetSource(){
+        return source;
+    }
+
+    virtual Vector2D GetCenterCoordinate() override {
+        return (bounds.GetMaximum() + bounds.GetMinimum()) / 2.0f;
+    }
+
+    virtual Vector2D GetSize() override {
+        return bounds.GetMaximum() - bounds.GetMinimum();
+    }
+
+    virtual Vector2D GetCoordinate(unsigned int count) override {
+        return source->GetCoordinate(GetLayoutIndex(count));
+    }
+
+    virtual int GetPixelIndex(Vector2D location) override {
+        int sourceIndex = source->GetPixelIndex(location);
+        unsigned int index;
+
+        if (sourceIndex < 0 || !ToViewIndex(sourceIndex, &index)) return -1;
+
+        return index;
+    }
+
+    virtual RGBColor* GetColor(unsigned int count) override {
+        if (colorMap[count] == NoPixel){
+            black = RGBColor();
+
+            return &black;
+        }
+
+        return source->GetColor(colorMap[count]);
+    }
+
+    virtual RGBColor* GetColors() override {
+        return nullptr;
+    }
+
+    virtual RGBColor* GetColorBuffer() override {
+        return nullptr;
+    }
+
+    virtual void SwapBuffers() override {}
+
+    virtual unsigned int GetPixelCount() override {
+        return pixelCount;
+    }
+
+    virtual bool Overlaps(BoundingBox2D* box) override {
+        return bounds.Overlaps(box);
+    }
+
+    virtual bool ContainsVector2D(Vector2D v) override {
+        return bounds.Contains(v);
+    }
+
+    virtual bool GetUpIndex(unsigned int count, unsigned int* upIndex) override {
+        unsigned int index;
+        bool valid = source->GetUpIndex(GetLayoutIndex(count), &index);
+
+        return valid && ToViewIndex(index, upIndex);
+    }
+
+    virtual bool GetDownIndex(unsigned int count, unsigned int* downIndex) override {
+        unsigned int index;
+        bool valid = source->GetDownIndex(GetLayoutIndex(count), &index);
+
+        return valid && ToViewIndex(index, downIndex);
+    }
+
+    virtual bool GetLeftIndex(unsigned int count, unsigned int* leftIndex) override {
+        unsigned int index;
+        bool valid = source->GetLeftIndex(GetLayoutIndex(count), &index);
+
+        return valid && ToViewIndex(index, leftIndex);
+    }
+
+    virtual bool GetRightIndex(unsigned int count, unsigned int* rightIndex) override {
+        unsigned int index;
+        bool valid = source->GetRightIndex(GetLayoutIndex(count), &index);
+
+        return valid && ToViewIndex(index, rightIndex);
+    }
+
+    virtual bool GetAlternateXIndex(unsigned int count, unsigned int* index) override {
+        unsigned int sourceIndex;
+        bool valid = source->GetAlternateXIndex(GetLayoutIndex(count), &sourceIndex);
+
+        return valid && ToViewIndex(sourceIndex, index);
+    }
+
+    virtual bool GetAlternateYIndex(unsigned int count, unsigned int* index) override {
+        unsigned int sourceIndex;
+        bool valid = source->GetAlternateYIndex(GetLayoutIndex(count), &sourceIndex);
+
+        return valid && ToViewIndex(sourceIndex, index);
+    }
+
+    virtual bool GetOffsetXIndex(unsigned int count, unsigned int* index, int x1) override {
+        unsigned int sourceIndex;
+        bool valid = source->GetOffsetXIndex(GetLayoutIndex(count), &sourceIndex, x1);
+
+        return valid && ToViewIndex(sourceIndex, index);
+    }
+
+    virtual bool GetOffsetYIndex(unsigned int count, unsigned int* index, int y1) override {
+        unsigned int sourceIndex;
+        bool valid = source->GetOffsetYIndex(GetLayoutIndex(count), &sourceIndex, y1);
+
+        return valid && ToViewIndex(sourceIndex, index);
+    }
+
+    virtual bool GetOffsetXYIndex(unsigned int count, unsigned int* index, int x1, int y1) override {
+        unsigned int sourceIndex;
+        bool valid = source->GetOffsetXYIndex(GetLayoutIndex(count), &sourceIndex, x1, y1);
+
+        return valid && ToViewIndex(sourceIndex, index);
+    }
+
+    virtual bool GetRadialIndex(unsigned int count, unsigned int* index, int pixels, float angle) override {
+        unsigned int sourceIndex;
+        bool valid = source->GetRadialIndex(GetLayoutIndex(count), &sourceIndex, pixels, angle);
+
+        return valid && ToViewIndex(sourceIndex, index);
+    }
+
+    virtual void GridSort() override {}//neighbors come from the source
+
+    virtual void SetSampleMode(SampleMode sampleMode) override {
+        source->SetSampleMode(sampleMode);
+    }
+
+    virtual SampleMode GetSampleMode() override {
+        return source->GetSampleMode();
+    }
+
+    virtual bool IsSampled(unsigned int count) override {
+        return source->IsSampled(GetLayoutIndex(count));
+    }
+
+    virtual void Upscale() override {
+        source->Upscale();
+    }
+};
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "..\PixelMap.h"
+
+//Generated by tools/PixelMapImporter.py from P3HUB75.h, do not edit by hand
+
+//64 x 32 evenly spaced grid
+PixelMap P3HUB75Map(2048, 64, Vector2D(0.0f, 0.0f), Vector2D(189.0f, 93.0f));
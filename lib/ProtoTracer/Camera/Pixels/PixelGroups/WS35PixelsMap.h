@@ -0,0 +1,239 @@
+#pragma once
+
+#include "..\PixelMap.h"
+
+//Generated by tools/PixelMapImporter.py from WS35Pixels.h, do not edit by hand
+
+//Quantization step 0.0078125, max error 0.0019875
+const int16_t WS35PixelsCoordinates[1142] PROGMEM = {
+    11218, 337, 11858, 337, 12498, 337, 13138, 337, 13778, 337, 14418, 337, 15058, 337, 15698, 337,
+    16338, 337, 16978, 337, 17618, 337, 18257, 978, 17617, 978, 16977, 978, 16337, 978, 15697, 978,
+    15057, 978, 14417, 978, 13777, 978, 13137, 978, 12497, 978, 11857, 978, 11217, 978, 10577, 978,
+    10578, 1617, 11218, 1617, 11858, 1617, 12498, 1617, 13138, 1617, 13778, 1617, 14418, 1617, 15058, 1617,
+    15698, 1617, 16338, 1617, 16978, 1617, 17618, 1617, 18258, 1617, 18897, 2258, 18257, 2258, 17615, 2258,
+    16977, 2258, 16337, 2258, 15697, 2258, 15057, 2258, 14417, 2258, 13777, 2258, 13135, 2258, 12497, 2258,
+    11857, 2258, 11217, 2258, 10577, 2258, 10578, 2897, 11218, 2897, 11858, 2897, 12498, 2897, 13138, 2897,
+    13778, 2897, 14418, 2897, 15058, 2897, 15698, 2897, 16338, 2897, 16978, 2897, 17618, 2897, 18258, 2897,
+    18898, 2897, 18897, 3538, 18257, 3538, 17617, 3538, 16977, 3538, 16337, 3538, 15697, 3538, 15057, 3538,
+    14417, 3538, 13777, 3538, 13137, 3538, 12497, 3538, 11857, 3538, 11217, 3538, 10577, 3538, 10578, 4177,
+    11218, 4177, 11858, 4177, 12498, 4177, 13138, 4177, 13778, 4177, 14418, 4177, 15058, 4177, 15698, 4177,
+    16338, 4177, 16978, 4177, 17618, 4177, 18258, 4177, 18898, 4177, 19538, 4177, 19537, 4818, 18897, 4818,
+    18257, 4818, 17617, 4818, 16977, 4818, 16337, 4818, 15697, 4818, 15057, 4818, 14417, 4818, 13777, 4818,
+    13137, 4818, 12497, 4818, 11857, 4818, 11217, 4818, 10577, 4818, 10578, 5457, 11218, 5457, 11858, 5457,
+    12498, 5457, 13138, 5457, 13778, 5457, 14418, 5457, 15058, 5457, 15698, 5457, 16338, 5457, 16978, 5457,
+    17618, 5457, 18258, 5457, 18898, 5457, 19538, 5457, 20178, 5457, 20177, 6098, 19537, 6098, 18897, 6098,
+    18257, 6098, 17617, 6098, 16977, 6098, 16337, 6098, 15697, 6098, 15057, 6098, 14417, 6098, 13777, 6098,
+    13137, 6098, 12497, 6098, 11857, 6098, 11217, 6098, 10577, 6098, 10578, 6737, 11218, 6737, 11858, 6737,
+    12498, 6737, 13138, 6737, 13778, 6737, 14418, 6737, 15058, 6737, 15698, 6737, 16338, 6737, 16978, 6737,
+    17618, 6737, 18258, 6737, 18898, 6737, 19538, 6737, 20178, 6737, 20818, 6737, 20817, 7378, 20177, 7378,
+    19537, 7378, 18897, 7378, 18257, 7378, 17617, 7378, 16977, 7378, 16337, 7378, 15697, 7378, 15057, 7378,
+    14417, 7378, 13777, 7378, 13137, 7378, 12497, 7378, 11857, 7378, 11217, 7378, 10577, 7378, 10578, 8017,
+    11218, 8017, 11858, 8017, 12498, 8017, 13138, 8017, 13778, 8017, 14418, 8017, 15058, 8017, 15698, 8017,
+    16338, 8017, 16978, 8017, 17618, 8017, 18258, 8017, 18898, 8017, 19538, 8017, 20178, 8017, 20818, 8017,
+    21458, 8017, 21455, 8658, 20817, 8658, 20177, 8658, 19537, 8658, 18897, 8658, 18257, 8658, 17617, 8658,
+    16977, 8658, 16337, 8658, 15697, 8658, 15057, 8658, 14417, 8658, 13777, 8658, 13137, 8658, 12497, 8658,
+    11857, 8658, 11217, 8658, 10577, 8658, 10578, 9297, 11218, 9297, 11858, 9297, 12498, 9297, 13138, 9297,
+    13778, 9297, 14418, 9297, 15058, 9297, 15698, 9297, 16338, 9297, 16978, 9297, 17618, 9297, 18258, 9297,
+    18898, 9297, 19538, 9297, 20178, 9297, 20818, 9297, 21458, 9297, 22097, 9938, 21457, 9938, 20817, 9938,
+    20177, 9938, 19537, 9938, 18897, 9938, 18257, 9938, 17617, 9938, 16977, 9938, 16337, 9938, 15697, 9938,
+    15057, 9938, 14417, 9938, 13777, 9938, 13137, 9938, 12497, 9938, 11857, 9938, 11217, 9938, 10577, 9938,
+    10578, 10577, 11218, 10577, 11858, 10577, 12498, 10577, 13138, 10577, 13778, 10577, 14418, 10577, 15058, 10577,
+    15698, 10577, 16338, 10577, 16978, 10577, 17618, 10577, 18258, 10577, 18898, 10577, 19538, 10577, 20178, 10577,
+    20818, 10577, 21458, 10577, 22098, 10577, 21457, 11218, 20817, 11218, 20177, 11218, 19537, 11218, 18897, 11218,
+    18257, 11218, 17617, 11218, 16977, 11218, 16337, 11218, 15697, 11218, 15057, 11218, 14417, 11218, 13777, 11218,
+    13137, 11218, 12497, 11218, 11857, 11218, 11217, 11218, 10577, 11218, 10578, 11857, 11218, 11857, 11858, 11857,
+    12498, 11857, 13138, 11857, 13778, 11857, 14418, 11857, 15058, 11857, 15698, 11857, 16338, 11857, 16978, 11857,
+    17618, 11857, 18258, 11857, 18898, 11857, 19538, 11857, 20178, 11857, 20818, 11857, 21458, 11857, 20817, 12498,
+    20177, 12498, 19537, 12498, 18897, 12498, 18257, 12498, 17617, 12498, 16977, 12498, 16337, 12498, 15697, 12498,
+    15057, 12498, 14417, 12498, 13777, 12498, 13137, 12498, 12497, 12498, 11857, 12498, 11217, 12498, 12498, 13137,
+    13138, 13137, 13778, 13137, 14418, 13137, 15058, 13137, 15698, 13137, 16338, 13137, 16978, 13137, 17618, 13137,
+    18258, 13137, 18898, 13137, 19538, 13137, 20178, 13137, 19537, 13778, 18897, 13778, 18257, 13778, 17617, 13778,
+    16977, 13778, 16337, 13778, 15697, 13778, 15057, 13778, 14417, 13778, 16338, 14417, 16978, 14417, 17618, 14417,
+    18258, 14417, 18898, 14417, 3410, 337, 4050, 337, 4690, 337, 5330, 337, 5970, 337, 6610, 337,
+    7250, 337, 7890, 337, 8530, 337, 9170, 337, 9809, 978, 9169, 978, 8529, 978, 7889, 978,
+    7249, 978, 6609, 978, 5969, 978, 5329, 978, 4689, 978, 4049, 978, 3409, 978, 2769, 978,
+    2770, 1617, 3410, 1617, 4050, 1617, 4690, 1617, 5330, 1617, 5970, 1617, 6610, 1617, 7250, 1617,
+    7890, 1617, 8530, 1617, 9170, 1617, 9810, 1617, 9809, 2258, 9169, 2258, 8529, 2258, 7889, 2258,
+    7249, 2258, 6609, 2258, 5969, 2258, 5329, 2258, 4689, 2258, 4049, 2258, 3409, 2258, 2769, 2258,
+    2129, 2258, 2130, 2897, 2770, 2897, 3410, 2897, 4050, 2897, 4690, 2897, 5330, 2897, 5970, 2897,
+    6610, 2897, 7250, 2897, 7890, 2897, 8530, 2897, 9170, 2897, 9810, 2897, 9809, 3538, 9169, 3538,
+    8529, 3538, 7889, 3538, 7249, 3538, 6609, 3538, 5969, 3538, 5329, 3538, 4689, 3538, 4049, 3538,
+    3409, 3538, 2769, 3538, 2129, 3538, 1489, 3538, 1490, 4177, 2130, 4177, 2770, 4177, 3410, 4177,
+    4050, 4177, 4690, 4177, 5330, 4177, 5970, 4177, 6610, 4177, 7250, 4177, 7890, 4177, 8530, 4177,
+    9170, 4177, 9810, 4177, 9809, 4818, 9169, 4818, 8529, 4818, 7889, 4818, 7249, 4818, 6609, 4818,
+    5969, 4818, 5329, 4818, 4689, 4818, 4049, 4818, 3409, 4818, 2769, 4818, 2129, 4818, 1489, 4818,
+    849, 4818, 850, 5457, 1490, 5457, 2130, 5457, 2770, 5457, 3410, 5457, 4050, 5457, 4690, 5457,
+    5330, 5457, 5970, 5457, 6610, 5457, 7250, 5457, 7890, 5457, 8530, 5457, 9170, 5457, 9810, 5457,
+    9809, 6098, 9169, 6098, 8529, 6098, 7889, 6098, 7249, 6098, 6609, 6098, 5969, 6098, 5329, 6098,
+    4689, 6098, 4049, 6098, 3409, 6098, 2769, 6098, 2129, 6098, 1489, 6098, 849, 6098, 850, 6737,
+    1490, 6737, 2130, 6737, 2770, 6737, 3410, 6737, 4050, 6737, 4690, 6737, 5330, 6737, 5970, 6737,
+    6610, 6737, 7250, 6737, 7890, 6737, 8530, 6737, 9170, 6737, 9810, 6737, 9809, 7378, 9169, 7378,
+    8529, 7378, 7889, 7378, 7249, 7378, 6609, 7378, 5969, 7378, 5329, 7378, 4689, 7378, 4049, 7378,
+    3409, 7378, 2769, 7378, 2129, 7378, 1489, 7378, 849, 7378, 850, 8017, 1490, 8017, 2130, 8017,
+    2770, 8017, 3410, 8017, 4050, 8017, 4690, 8017, 5330, 8017, 5970, 8017, 6610, 8017, 7250, 8017,
+    7890, 8017, 8530, 8017, 9170, 8017, 9810, 8017, 9809, 8658, 9169, 8658, 8529, 8658, 7889, 8658,
+    7249, 8658, 6609, 8658, 5969, 8658, 5329, 8658, 4689, 8658, 4049, 8658, 3409, 8658, 2769, 8658,
+    2129, 8658, 1489, 8658, 2770, 9297, 3410, 9297, 4050, 9297, 4690, 9297, 5330, 9297, 5970, 9297,
+    6610, 9297, 7250, 9297, 7890, 9297, 8530, 9297, 9170, 9297, 9810, 9297, 9809, 9938, 9169, 9938,
+    8529, 9938, 7889, 9938, 7249, 9938, 6609, 9938, 5969, 9938, 5329, 9938, 4689, 9938, 5970, 10577,
+    6610, 10577, 7250, 10577, 7890, 10577, 8530, 10577, 9170, 10577, 9810, 10577, 9809, 11218, 9169, 11218,
+    8529, 11218, 7889, 11218, 9170, 11857
+};
+
+const uint16_t WS35PixelsUp[571] PROGMEM = {
+    22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 36, 35, 34, 33, 32,
+    31, 30, 29, 28, 27, 26, 25, 24, 50, 49, 48, 47, 46, 45, 44, 43,
+    42, 41, 40, 39, 38, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54,
+    53, 52, 51, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66,
+    65, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 108,
+    107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 123, 122,
+    121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111, 110, 109, 140, 139, 138,
+    137, 136, 135, 134, 133, 132, 131, 130, 129, 128, 127, 126, 125, 156, 155, 154,
+    153, 152, 151, 150, 149, 148, 147, 146, 145, 144, 143, 142, 141, 174, 173, 172,
+    171, 170, 169, 168, 167, 166, 165, 164, 163, 162, 161, 160, 159, 158, 191, 190,
+    189, 188, 187, 186, 185, 184, 183, 182, 181, 180, 179, 178, 177, 176, 175, 210,
+    209, 208, 207, 206, 205, 204, 203, 202, 201, 200, 199, 198, 197, 196, 195, 194,
+    193, 228, 227, 226, 225, 224, 223, 222, 221, 220, 219, 218, 217, 216, 215, 214,
+    213, 212, 211, 247, 246, 245, 244, 243, 242, 241, 240, 239, 238, 237, 236, 235,
+    234, 233, 232, 231, 230, 266, 265, 264, 263, 262, 261, 260, 259, 258, 257, 256,
+    255, 254, 253, 252, 251, 250, 249, 248, 284, 283, 282, 281, 280, 279, 278, 277,
+    276, 275, 274, 273, 272, 271, 270, 269, 268, 267, 65535, 302, 301, 300, 299, 298,
+    297, 296, 295, 294, 293, 292, 291, 290, 289, 288, 287, 286, 285, 65535, 318, 317,
+    316, 315, 314, 313, 312, 311, 310, 309, 308, 307, 306, 305, 304, 303, 65535, 65535,
+    331, 330, 329, 328, 327, 326, 325, 324, 323, 322, 321, 320, 319, 65535, 65535, 65535,
+    65535, 65535, 340, 339, 338, 337, 336, 335, 334, 333, 332, 65535, 65535, 345, 344, 343,
+    342, 341, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 366, 365, 364, 363, 362, 361,
+    360, 359, 358, 357, 379, 378, 377, 376, 375, 374, 373, 372, 371, 370, 369, 368,
+    391, 390, 389, 388, 387, 386, 385, 384, 383, 382, 381, 380, 405, 404, 403, 402,
+    401, 400, 399, 398, 397, 396, 395, 394, 393, 418, 417, 416, 415, 414, 413, 412,
+    411, 410, 409, 408, 407, 406, 433, 432, 431, 430, 429, 428, 427, 426, 425, 424,
+    423, 422, 421, 420, 447, 446, 445, 444, 443, 442, 441, 440, 439, 438, 437, 436,
+    435, 434, 463, 462, 461, 460, 459, 458, 457, 456, 455, 454, 453, 452, 451, 450,
+    449, 478, 477, 476, 475, 474, 473, 472, 471, 470, 469, 468, 467, 466, 465, 464,
+    493, 492, 491, 490, 489, 488, 487, 486, 485, 484, 483, 482, 481, 480, 479, 508,
+    507, 506, 505, 504, 503, 502, 501, 500, 499, 498, 497, 496, 495, 494, 523, 522,
+    521, 520, 519, 518, 517, 516, 515, 514, 513, 512, 511, 510, 509, 65535, 537, 536,
+    535, 534, 533, 532, 531, 530, 529, 528, 527, 526, 525, 524, 549, 548, 547, 546,
+    545, 544, 543, 542, 541, 540, 539, 538, 65535, 65535, 65535, 65535, 65535, 558, 557, 556,
+    555, 554, 553, 552, 551, 550, 565, 564, 563, 562, 561, 560, 559, 65535, 65535, 65535,
+    65535, 65535, 569, 568, 567, 566, 65535, 570, 65535, 65535, 65535
+};
+
+const uint16_t WS35PixelsDown[571] PROGMEM = {
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 10, 9, 8, 7,
+    6, 5, 4, 3, 2, 1, 0, 65535, 23, 22, 21, 20, 19, 18, 17, 16,
+    15, 14, 13, 12, 11, 65535, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+    26, 25, 24, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38,
+    37, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 78,
+    77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 65535, 93, 92,
+    91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 108, 107, 106,
+    105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 65535, 124, 123, 122,
+    121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111, 110, 109, 140, 139, 138,
+    137, 136, 135, 134, 133, 132, 131, 130, 129, 128, 127, 126, 125, 65535, 157, 156,
+    155, 154, 153, 152, 151, 150, 149, 148, 147, 146, 145, 144, 143, 142, 141, 174,
+    173, 172, 171, 170, 169, 168, 167, 166, 165, 164, 163, 162, 161, 160, 159, 158,
+    65535, 192, 191, 190, 189, 188, 187, 186, 185, 184, 183, 182, 181, 180, 179, 178,
+    177, 176, 175, 210, 209, 208, 207, 206, 205, 204, 203, 202, 201, 200, 199, 198,
+    197, 196, 195, 194, 193, 65535, 228, 227, 226, 225, 224, 223, 222, 221, 220, 219,
+    218, 217, 216, 215, 214, 213, 212, 211, 247, 246, 245, 244, 243, 242, 241, 240,
+    239, 238, 237, 236, 235, 234, 233, 232, 231, 230, 229, 265, 264, 263, 262, 261,
+    260, 259, 258, 257, 256, 255, 254, 253, 252, 251, 250, 249, 248, 284, 283, 282,
+    281, 280, 279, 278, 277, 276, 275, 274, 273, 272, 271, 270, 269, 268, 267, 301,
+    300, 299, 298, 297, 296, 295, 294, 293, 292, 291, 290, 289, 288, 287, 286, 316,
+    315, 314, 313, 312, 311, 310, 309, 308, 307, 306, 305, 304, 330, 329, 328, 327,
+    326, 325, 324, 323, 322, 337, 336, 335, 334, 333, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 355, 354, 353, 352, 351, 350, 349, 348, 347, 346, 65535,
+    367, 366, 365, 364, 363, 362, 361, 360, 359, 358, 357, 356, 379, 378, 377, 376,
+    375, 374, 373, 372, 371, 370, 369, 368, 65535, 392, 391, 390, 389, 388, 387, 386,
+    385, 384, 383, 382, 381, 380, 405, 404, 403, 402, 401, 400, 399, 398, 397, 396,
+    395, 394, 393, 65535, 419, 418, 417, 416, 415, 414, 413, 412, 411, 410, 409, 408,
+    407, 406, 433, 432, 431, 430, 429, 428, 427, 426, 425, 424, 423, 422, 421, 420,
+    65535, 448, 447, 446, 445, 444, 443, 442, 441, 440, 439, 438, 437, 436, 435, 434,
+    463, 462, 461, 460, 459, 458, 457, 456, 455, 454, 453, 452, 451, 450, 449, 478,
+    477, 476, 475, 474, 473, 472, 471, 470, 469, 468, 467, 466, 465, 464, 493, 492,
+    491, 490, 489, 488, 487, 486, 485, 484, 483, 482, 481, 480, 479, 508, 507, 506,
+    505, 504, 503, 502, 501, 500, 499, 498, 497, 496, 495, 494, 523, 522, 521, 520,
+    519, 518, 517, 516, 515, 514, 513, 512, 511, 510, 535, 534, 533, 532, 531, 530,
+    529, 528, 527, 526, 525, 524, 549, 548, 547, 546, 545, 544, 543, 542, 541, 556,
+    555, 554, 553, 552, 551, 550, 565, 564, 563, 562, 567
+};
+
+const uint16_t WS35PixelsLeft[571] PROGMEM = {
+    355, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 356, 379, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 380, 405, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+    63, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 406, 433,
+    79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 95, 96,
+    97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 434, 463, 109, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 126, 127, 128,
+    129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 464, 493, 141, 142,
+    143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 159, 160,
+    161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 494, 523,
+    175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+    191, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+    209, 210, 524, 549, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+    223, 224, 225, 226, 227, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240,
+    241, 242, 243, 244, 245, 246, 247, 550, 565, 248, 249, 250, 251, 252, 253, 254,
+    255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 268, 269, 270, 271, 272,
+    273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 566, 570, 285, 286,
+    287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 304,
+    305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 65535, 65535,
+    319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 333, 334, 335, 336,
+    337, 338, 339, 340, 65535, 65535, 341, 342, 343, 344, 65535, 346, 347, 348, 349, 350,
+    351, 352, 353, 354, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 65535,
+    65535, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 381, 382, 383, 384,
+    385, 386, 387, 388, 389, 390, 391, 392, 65535, 65535, 393, 394, 395, 396, 397, 398,
+    399, 400, 401, 402, 403, 404, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416,
+    417, 418, 419, 65535, 65535, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
+    431, 432, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
+    65535, 65535, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462,
+    465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 65535, 65535,
+    479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 495, 496,
+    497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 65535, 65535, 509, 510,
+    511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 525, 526, 527, 528,
+    529, 530, 531, 532, 533, 534, 535, 536, 537, 65535, 65535, 538, 539, 540, 541, 542,
+    543, 544, 545, 546, 547, 548, 551, 552, 553, 554, 555, 556, 557, 558, 65535, 65535,
+    559, 560, 561, 562, 563, 564, 567, 568, 569, 65535, 65535
+};
+
+const uint16_t WS35PixelsRight[571] PROGMEM = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 65535, 65535, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 65535, 65535, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+    47, 48, 49, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65535, 65535, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 65535, 65535, 94,
+    95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 65535, 65535, 125, 126,
+    127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 142, 143, 144,
+    145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 65535, 65535, 158,
+    159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 176,
+    177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
+    65535, 65535, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+    207, 208, 209, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+    225, 226, 227, 228, 65535, 65535, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238,
+    239, 240, 241, 242, 243, 244, 245, 246, 249, 250, 251, 252, 253, 254, 255, 256,
+    257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 65535, 65535, 267, 268, 269, 270,
+    271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 286, 287, 288,
+    289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 65535, 65535,
+    303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 320,
+    321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 65535, 65535, 332, 333, 334,
+    335, 336, 337, 338, 339, 342, 343, 344, 345, 65535, 347, 348, 349, 350, 351, 352,
+    353, 354, 355, 0, 23, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366,
+    369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 24, 50, 380, 381, 382,
+    383, 384, 385, 386, 387, 388, 389, 390, 391, 394, 395, 396, 397, 398, 399, 400,
+    401, 402, 403, 404, 405, 51, 78, 406, 407, 408, 409, 410, 411, 412, 413, 414,
+    415, 416, 417, 418, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432,
+    433, 79, 108, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
+    447, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 109,
+    140, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 480,
+    481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 141, 174, 494,
+    495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 510, 511, 512,
+    513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 175, 210, 524, 525, 526,
+    527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 539, 540, 541, 542, 543, 544,
+    545, 546, 547, 548, 549, 211, 247, 550, 551, 552, 553, 554, 555, 556, 557, 560,
+    561, 562, 563, 564, 565, 248, 284, 566, 567, 568, 285
+};
+
+PixelMap WS35PixelsMap(WS35PixelsCoordinates, WS35PixelsUp, WS35PixelsDown, WS35PixelsLeft, WS35PixelsRight, 571, 0.0078125f, Vector2D(6.6312f, 2.6312f), Vector2D(172.6388f, 112.6312f));
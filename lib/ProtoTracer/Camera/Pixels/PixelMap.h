@@ -0,0 +1,90 @@
+#pragma once
+
+#include <Arduino.h>
+#include "..\..\Utils\Math\Vector2D.h"
+
+//Compact pixel layout generated by tools/PixelMapImporter.py, coordinates and neighbor tables are stored in flash
+class PixelMap {
+public:
+    static const uint16_t NoNeighbor = 0xFFFF;
+
+private:
+    const int16_t* coordinates;//interleaved X/Y pairs, multiply by scale to get the layout position
+    const uint16_t* up;
+    const uint16_t* down;
+    const uint16_t* left;
+    const uint16_t* right;
+    unsigned int pixelCount;
+    float scale;
+    Vector2D minimum;
+    Vector2D maximum;
+    bool isRectangular;
+    uint16_t rowCount;//pixels per row, matches the PixelGroup rectangular constructor
+
+public:
+    //Irregular layout with precomputed neighbor tables
+    PixelMap(const int16_t* coordinates, const uint16_t* up, const uint16_t* down, const uint16_t* left, const uint16_t* right, unsigned int pixelCount, float scale, Vector2D minimum, Vector2D maximum)
+        : coordinates(coordinates), up(up), down(down), left(left), right(right), pixelCount(pixelCount), scale(scale), minimum(minimum), maximum(maximum), isRectangular(false), rowCount(0) {}
+
+    //Evenly spaced row-major grid with x and y increasing from the first pixel, no per-pixel data is needed
+    //the importer writes any other wiring (reversed, column-major, serpentine) as an irregular layout
+    PixelMap(unsigned int pixelCount, uint16_t rowCount, Vector2D minimum, Vector2D maximum)
+        : coordinates(nullptr), up(nullptr), down(nullptr), left(nullptr), right(nullptr), pixelCount(pixelCount), scale(1.0f), minimum(minimum), maximum(maximum), isRectangular(true), rowCount(rowCount) {}
+
+    unsigned int GetPixelCount(){
+        return pixelCount;
+    }
+
+    bool IsRectangular(){
+        return isRectangular;
+    }
+
+    uint16_t GetRowCount(){
+        return rowCount;
+    }
+
+    Vector2D GetMinimum(){
+        return minimum;
+    }
+
+    Vector2D GetMaximum(){
+        return maximum;
+    }
+
+    //grids are computed, so a group that reads the map in reverse can treat them like an irregular layout
+    Vector2D GetCoordinate(unsigned int index){
+        if (isRectangular){
+            uint16_t colCount = pixelCount / rowCount;
+            float pitchX = rowCount > 1 ? (maximum.X - minimum.X) / float(rowCount - 1) : 0.0f;
+            float pitchY = colCount > 1 ? (maximum.Y - minimum.Y) / float(colCount - 1) : 0.0f;
+
+            return Vector2D(minimum.X + float(index % rowCount) * pitchX, minimum.Y + float(index / rowCount) * pitchY);
+        }
+
+        return Vector2D(float(coordinates[index * 2]) * scale, float(coordinates[index * 2 + 1]) * scale);
+    }
+
+    uint16_t GetUpIndex(unsigned int index){
+        if (isRectangular) return index + rowCount < pixelCount ? index + rowCount : NoNeighbor;
+
+        return up[index];
+    }
+
+    uint16_t GetDownIndex(unsigned int index){
+        if (isRectangular) return index >= rowCount ? index - rowCount : NoNeighbor;
+
+        return down[index];
+    }
+
+    uint16_t GetLeftIndex(unsigned int index){
+        if (isRectangular) return index % rowCount != 0 ? index - 1 : NoNeighbor;
+
+        return left[index];
+    }
+
+    uint16_t GetRightIndex(unsigned int index){
+        if (isRectangular) return (index + 1) % rowCount != 0 && index + 1 < pixelCount ? index + 1 : NoNeighbor;
+
+        return right[index];
+    }
+};
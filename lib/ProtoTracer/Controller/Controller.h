@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include "..\Utils\Math\Mathematics.h"
 #include "..\Camera\CameraManager\CameraManager.h"
+#include "OutputLUT.h"
 
 class Controller {
 private:
@@ -29,6 +30,24 @@ protected:
     CameraManager* cameras;
     uint8_t brightness;
     uint8_t accentBrightness;
+    OutputLUT* outputLUT = nullptr;
+    OutputLUT* accentOutputLUT = nullptr;
+
+    //call at the start of Display, hardware brightness should be left at maximum while the LUT is in use
+    void UpdateOutputLUT(){
+        if (!outputLUT) return;
+
+        outputLUT->Update(brightness);
+        accentOutputLUT->Update(accentBrightness);
+    }
+
+    RGBColor GetOutputColor(IPixelGroup* pixelGroup, uint16_t index){
+        return outputLUT ? outputLUT->Apply(*pixelGroup->GetColor(index), index) : *pixelGroup->GetColor(index);
+    }
+
+    RGBColor GetAccentOutputColor(IPixelGroup* pixelGroup, uint16_t index){
+        return accentOutputLUT ? accentOutputLUT->Apply(*pixelGroup->GetColor(index), index) : *pixelGroup->GetColor(index);
+    }
 
     Controller(CameraManager* cameras, uint8_t maxBrightness, uint8_t maxAccentBrightness){
         this->cameras = cameras;
@@ -63,6 +82,30 @@ public:
         }
     }
 
+    //moves brightness and gamma into a per-channel lookup with temporal dithering, applied at output time
+    void EnableOutputLUT(float gamma = 2.2f, bool dither = true){
+        if (!outputLUT){
+            outputLUT = new OutputLUT();
+            accentOutputLUT = new OutputLUT();
+        }
+
+        outputLUT->SetGamma(gamma);
+        outputLUT->SetDither(dither);
+        accentOutputLUT->SetGamma(gamma);
+        accentOutputLUT->SetDither(dither);
+    }
+
+    void SetWhiteBalance(float red, float green, float blue){
+        if (!outputLUT) return;
+
+        outputLUT->SetChannelScale(red, green, blue);
+        accentOutputLUT->SetChannelScale(red, green, blue);
+    }
+
+    bool UseOutputLUT(){
+        return outputLUT != nullptr;
+    }
+
     virtual void Initialize() = 0;
     virtual void Display() = 0;
 
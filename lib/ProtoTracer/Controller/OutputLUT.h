@@ -0,0 +1,90 @@
+#pragma once
+
+#include <Arduino.h>
+#include "..\Utils\Math\Mathematics.h"
+#include "..\Utils\RGBColor.h"
+
+//Gamma and brightness lookup applied once per pixel at output time, values are stored as 8.8 fixed point for dithering
+class OutputLUT {
+private:
+    uint16_t curve[256];//gamma only, full brightness
+    uint16_t red[256];
+    uint16_t green[256];
+    uint16_t blue[256];
+
+    float gamma = 2.2f;
+    float redScale = 1.0f;
+    float greenScale = 1.0f;
+    float blueScale = 1.0f;
+    uint8_t brightness = 0;
+    bool dither = true;
+    bool isCurveDirty = true;
+    bool isDirty = true;
+    uint8_t frame = 0;
+
+    void BuildCurve(){
+        for (uint16_t i = 0; i < 256; i++){
+            curve[i] = uint16_t(powf(float(i) / 255.0f, gamma) * 65280.0f + 0.5f);//255 << 8
+        }
+
+        isCurveDirty = false;
+    }
+
+    void BuildChannel(uint16_t* table, float channelScale){
+        uint32_t scale = uint32_t(Mathematics::Constrain(channelScale, 0.0f, 1.0f) * float(brightness) * 257.0f);//brightness 255 maps to 65535
+
+        for (uint16_t i = 0; i < 256; i++){
+            table[i] = (uint32_t(curve[i]) * scale) >> 16;
+        }
+    }
+
+public:
+    OutputLUT() {}
+
+    void SetGamma(float gamma){
+        this->gamma = gamma;
+        isCurveDirty = true;
+        isDirty = true;
+    }
+
+    void SetChannelScale(float redScale, float greenScale, float blueScale){//white balance
+        this->redScale = redScale;
+        this->greenScale = greenScale;
+        this->blueScale = blueScale;
+        isDirty = true;
+    }
+
+    void SetDither(bool dither){
+        this->dither = dither;
+    }
+
+    //call once per displayed frame, only rebuilds when the brightness or curve changed
+    void Update(uint8_t brightness){
+        if (brightness != this->brightness){
+            this->brightness = brightness;
+            isDirty = true;
+        }
+
+        if (isCurveDirty) BuildCurve();
+
+        if (isDirty){
+            BuildChannel(red, redScale);
+            BuildChannel(green, greenScale);
+            BuildChannel(blue, blueScale);
+
+            isDirty = false;
+        }
+
+        frame++;
+    }
+
+    RGBColor Apply(const RGBColor& color, uint16_t index){
+        static const uint8_t ditherPattern[16] = { 8, 136, 40, 168, 200, 72, 232, 104, 56, 184, 24, 152, 248, 120, 216, 88 };
+
+        //ordered threshold that shifts every frame, so fractional levels average out over time instead of truncating
+        //without dither the fixed threshold is the mean of the pattern, rounding to nearest so full white stays 255
+        uint16_t threshold = dither ? ditherPattern[(index * 7 + frame) & 0x0F] : 128;
+
+        return RGBColor((red[color.R] + threshold) >> 8, (green[color.G] + threshold) >> 8, (blue[color.B] + threshold) >> 8);
+    }
+};
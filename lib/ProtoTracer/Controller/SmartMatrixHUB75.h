@@ -10,6 +10,7 @@
 #include "Controller.h"
 #include "..\Camera\CameraManager\CameraManager.h"
 #include "..\Camera\Pixels\PixelGroup.h"
+#include "..\Camera\Pixels\PixelGroupView.h"
 
 //HUB75
 #define ENABLE_HUB75_REFRESH    1
@@ -39,9 +40,16 @@ SMARTMATRIX_APA_ALLOCATE_BUFFERS(apamatrix, kApaMatrixWidth, kApaMatrixHeight, k
 SMARTMATRIX_ALLOCATE_BACKGROUND_LAYER(apaBackgroundLayer, kApaMatrixWidth, kApaMatrixHeight, COLOR_DEPTH, kApaBackgroundLayerOptions);
 
 class SmartMatrixHUB75 : public Controller {
+private:
+    PixelGroupView* mirroredPixels = nullptr;//lower panel shows the face mirrored from the same render
+
 public:
     SmartMatrixHUB75(CameraManager* cameras, uint8_t maxBrightness, uint8_t maxAccentBrightness) : Controller(cameras, maxBrightness, maxAccentBrightness){}
 
+    ~SmartMatrixHUB75(){
+        delete mirroredPixels;
+    }
+
     void Initialize() override{
         //HUB75
         matrix.addLayer(&backgroundLayer);
@@ -60,8 +68,10 @@ public:
     }
 
     void Display() override {
-        matrix.setBrightness(brightness);
-        apamatrix.setBrightness(accentBrightness / 2);
+        UpdateOutputLUT();
+
+        matrix.setBrightness(UseOutputLUT() ? 255 : brightness);
+        apamatrix.setBrightness(UseOutputLUT() ? 127 : accentBrightness / 2);
 
         while(apaBackgroundLayer.isSwapPending());
         rgb24 *apabuffer = apaBackgroundLayer.backBuffer();
@@ -69,19 +79,24 @@ public:
         IPixelGroup* camPixels = cameras->GetCameras()[0]->GetPixelGroup();
         IPixelGroup* camSidePixels = cameras->GetCameras()[1]->GetPixelGroup();
 
+        if (!mirroredPixels) mirroredPixels = new PixelGroupView(camPixels, PixelGroupView::MirrorX);
+
         for (uint16_t y = 0; y < 32; y++) {
             for (uint16_t x = 0; x < 64; x++){
                 uint16_t pixelNum = y * 64 + x;
 
-                rgb24 rgbColor = rgb24((uint16_t)camPixels->GetColor(pixelNum)->R, (uint16_t)camPixels->GetColor(pixelNum)->G, (uint16_t)camPixels->GetColor(pixelNum)->B);
+                RGBColor color = GetOutputColor(camPixels, pixelNum);
+                RGBColor mirroredColor = GetOutputColor(mirroredPixels, pixelNum);
 
-                backgroundLayer.drawPixel(x, (31 - y), rgbColor);
-                backgroundLayer.drawPixel(63 - x, (31 - y) + 32, rgbColor);
+                backgroundLayer.drawPixel(x, (31 - y), rgb24((uint16_t)color.R, (uint16_t)color.G, (uint16_t)color.B));
+                backgroundLayer.drawPixel(x, (31 - y) + 32, rgb24((uint16_t)mirroredColor.R, (uint16_t)mirroredColor.G, (uint16_t)mirroredColor.B));
             }
         }
 
         for (uint16_t x = 0; x < kApaMatrixWidth; x++){
-            apabuffer[x] = rgb24((uint16_t)camSidePixels->GetColor(x)->R, (uint16_t)camSidePixels->GetColor(x)->G, (uint16_t)camSidePixels->GetColor(x)->B);
+            RGBColor color = GetAccentOutputColor(camSidePixels, x);
+
+            apabuffer[x] = rgb24((uint16_t)color.R, (uint16_t)color.G, (uint16_t)color.B);
         }
         
         backgroundLayer.swapBuffers();
@@ -1,11 +1,105 @@
-#include "RenderingEngine.h"
+#include <Arduino.h>
+#include "Engine.h"
+#include "..\Scene\Materials\Utils\MaterialProfiler.h"
+
+uint32_t RenderingEngine::frameBudget = 0;
+uint32_t RenderingEngine::frameTime = 0;
+
+void RenderingEngine::RenderCamera(Scene* scene, CameraBase* camera) {
+    Rasterizer::Rasterize(scene, camera);
+
+    if (scene->UseEffect() && camera->GetPixelGroup()->GetColors()) {
+        scene->GetEffect()->ApplyEffect(camera->GetPixelGroup(), scene->GetFrameContext());
+    }
+}
+
+void RenderingEngine::UpdateLOD(CameraBase* camera) {//steps resolution down when the last frame overran, back up once there is headroom
+    if (!camera->UseDynamicLOD() || frameBudget == 0 || frameTime == 0) return;
+
+    IPixelGroup* pixelGroup = camera->GetPixelGroup();
+    IPixelGroup::SampleMode sampleMode = pixelGroup->GetSampleMode();
+
+    if (frameTime > frameBudget) {
+        if (sampleMode == IPixelGroup::Full) pixelGroup->SetSampleMode(IPixelGroup::Checkerboard);
+        else if (sampleMode == IPixelGroup::Checkerboard) pixelGroup->SetSampleMode(IPixelGroup::Quarter);
+    }
+    else if (frameTime < frameBudget / 2) {
+        if (sampleMode == IPixelGroup::Quarter) pixelGroup->SetSampleMode(IPixelGroup::Checkerboard);
+        else if (sampleMode == IPixelGroup::Checkerboard) pixelGroup->SetSampleMode(IPixelGroup::Full);
+    }
+}
 
 void RenderingEngine::Render(Scene* scene, CameraManager* cameraManager) {
-    for (int i = 0; i < cameraManager->GetCameraCount(); i++) {
-        Rasterizer::Rasterize(scene, cameraManager->GetCameras()[i])
+    CameraBase** cameras = cameraManager->GetCameras();
+    uint8_t count = cameraManager->GetCameraCount();
+    uint32_t frameStart = micros();
+    uint16_t currentPriority = 0;
+
+    scene->GetFrameContext()->SetBudget(frameBudget, frameTime);
+
+    //per frame material work once before any camera samples, shared materials skip repeats
+    for (uint8_t i = 0; i < scene->GetObjectCount(); i++) {
+        Object3D* object = scene->GetObjects()[i];
+
+        if (object->IsEnabled() && object->GetMaterial()) object->GetMaterial()->PrepareFrame(scene->GetFrameContext());
+    }
 
-        if (scene->UseEffect()) {
-            scene->GetEffect()->ApplyEffect(cameraManager->GetCameras()[i]->GetPixelGroup());
+    //visit cameras from highest to lowest priority, keeping the manager order within a priority level
+    while (true) {
+        uint16_t nextPriority = 256;
+
+        for (uint8_t i = 0; i < count; i++) {
+            uint8_t priority = cameras[i]->GetPriority();
+
+            if (priority >= currentPriority && priority < nextPriority) nextPriority = priority;
         }
+
+        if (nextPriority > 255) break;
+
+        for (uint8_t i = 0; i < count; i++) {
+            CameraBase* camera = cameras[i];
+
+            if (camera->GetPriority() != nextPriority) continue;
+
+            uint32_t startTime = micros();
+
+            if (!camera->IsDue(startTime)) continue;
+
+            bool withinBudget = frameBudget == 0 || float(startTime - frameStart) + camera->GetRenderDuration() <= float(frameBudget);
+
+            if (nextPriority == 0 || withinBudget || camera->IsSkipLimitReached()) {
+                UpdateLOD(camera);
+                RenderCamera(scene, camera);
+
+                camera->MarkRendered(startTime, micros());
+            }
+            else {
+                camera->MarkSkipped();
+            }
+        }
+
+        currentPriority = nextPriority + 1;
     }
+
+    frameTime = micros() - frameStart;
+
+#if defined(PROFILE_MATERIALS)
+    MaterialProfiler::EndFrame();
+#endif
+}
+
+void RenderingEngine::SetFrameBudget(uint32_t frameBudget) {
+    RenderingEngine::frameBudget = frameBudget;
+}
+
+uint32_t RenderingEngine::GetFrameBudget() {
+    return frameBudget;
+}
+
+uint32_t RenderingEngine::GetFrameTime() {
+    return frameTime;
+}
+
+int32_t RenderingEngine::GetRemainingBudget() {
+    return int32_t(frameBudget) - int32_t(frameTime);
 }
@@ -5,7 +5,19 @@
 #include "..\Renderer\Rasterizer\Rasterizer.h"
 
 class RenderingEngine {
+private:
+    static uint32_t frameBudget;//micros, 0 renders every due camera
+    static uint32_t frameTime;
+
+    static void RenderCamera(Scene* scene, CameraBase* camera);
+    static void UpdateLOD(CameraBase* camera);
+
 public:
     static void Render(Scene* scene, CameraManager* cameraManager);
-    
+
+    static void SetFrameBudget(uint32_t frameBudget);
+    static uint32_t GetFrameBudget();
+    static uint32_t GetFrameTime();
+    static int32_t GetRemainingBudget();
+
 };
@@ -14,7 +14,7 @@
 #include "..\..\Materials\Animated\RainbowNoise.h"
 #include "..\..\Materials\Animated\RainbowSpiral.h"
 
-#include "..\..\Materials\CombineMaterial.h"
+#include "..\..\Materials\ComposeMaterial.h"
 
 #include "..\AnimationTracks\BlinkTrack.h"
 
@@ -34,7 +34,13 @@ private:
     RGBColor gradientSpectrum[2] = {RGBColor(25, 50, 255), RGBColor(50, 255, 50)};
     GradientMaterial<2> gradientMat = GradientMaterial<2>(gradientSpectrum, 350.0f, false);
     
-    CombineMaterial<4> faceMaterial;
+    //the layer methods never change, only the two face swaps fade in and out
+    ComposeMaterial<BlendAdd<GradientMaterial<2>>, BlendLighten<RainbowNoise>, BlendReplace<RainbowSpiral>, BlendReplace<SimpleMaterial>> faceMaterial = {
+        &gradientMat,
+        BlendLighten<RainbowNoise>(&rainbowNoise, 0.6f),
+        BlendReplace<RainbowSpiral>(&rainbowSpiral, 0.0f),
+        BlendReplace<SimpleMaterial>(&redMaterial, 0.0f)
+    };
     
     SpectrumAnalyzer sA = SpectrumAnalyzer(22, Vector2D(250, 200), Vector2D(120, 100), true, true);
 
@@ -99,13 +105,6 @@ private:
         eEA.SetInterpolationMethod(NukudeFace::vrc_v_ss, EasyEaseInterpolation::Linear);
     }
 
-    void SetMaterials(){
-        faceMaterial.AddMaterial(Material::Add, &gradientMat, 1.0f);
-        faceMaterial.AddMaterial(Material::Lighten, &rainbowNoise, 0.6f);
-        faceMaterial.AddMaterial(Material::Replace, &rainbowSpiral, 0.0f);
-        faceMaterial.AddMaterial(Material::Replace, &redMaterial, 0.0f);
-    }
-
 public:
     VesperAnimation() {
         scene.AddObject(pM.GetObject());
@@ -116,8 +115,6 @@ public:
 
         ChangeInterpolationMethods();
 
-        SetMaterials();
-
         pM.GetObject()->SetMaterial(&faceMaterial);
 
         MenuButtonHandler::Initialize(0, 7, 1000);//7 is number of faces
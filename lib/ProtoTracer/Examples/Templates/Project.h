@@ -42,9 +42,15 @@ public:
     virtual void FadeOut(float stepRatio) = 0;
     virtual void Update(float ratio) = 0;
 
+    FrameContext* GetFrameContext(){
+        return scene.GetFrameContext();
+    }
+
     void UpdateTime(float ratio){
         previousTime = micros();
 
+        scene.GetFrameContext()->Begin(previousTime);//one clock read shared by the whole frame
+
         Update(ratio);
 
         animationTime = ((float)(micros() - previousTime)) / 1000000.0f;
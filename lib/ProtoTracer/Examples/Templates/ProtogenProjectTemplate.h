@@ -185,7 +185,7 @@ protected:
            isBooped = boop.isBooped();
         }
 
-        hud.SetEffect(Menu::GetEffect());// Pull Effect from menu and store reference in hud for observing data
+        hud.SetEffect(Menu::GetEffectTransition());// Pull Effect from menu and store reference in hud for observing data, crossfaded on change
         hud.Update();
         this->scene.SetEffect(&hud);// Use HUD as effect for overlay/data extraction
 
@@ -435,6 +435,8 @@ public:
         objA.SetCameraMin(camMin);
         objA.SetJustification(ObjectAlign::Stretch);
         objA.SetMirrorX(true);
+
+        flowNoise.SetQuality(0.5f, camMin, camMax);// Face area reads a noise grid rebuilt once per frame, see SimplexNoise::SetQuality
         
         this->scene.EnableEffect();
 
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <Arduino.h>
+#include "..\..\Utils\RGBColor.h"
+
+//Shared bookkeeping of the benchmarks: FNV-1a checksums of the output colors, comparison against a recorded
+//reference table and a record mode that prints a new table to paste over the old one
+//floating point math differs between targets, so each benchmark keeps one table per target, 0 marks an unrecorded case
+class BenchmarkReport {
+public:
+    static const uint32_t hashStart = 2166136261u;
+
+private:
+    const uint32_t* references;
+    uint32_t* checksums;
+    uint16_t caseCount;
+    uint16_t mismatches = 0;
+    uint16_t unrecorded = 0;
+    bool recordMode = false;
+
+public:
+    BenchmarkReport(const uint32_t* references, uint16_t caseCount) : references(references), caseCount(caseCount) {
+        checksums = new uint32_t[caseCount];
+    }
+
+    ~BenchmarkReport(){
+        delete[] checksums;
+    }
+
+    BenchmarkReport(const BenchmarkReport&) = delete;
+    BenchmarkReport& operator=(const BenchmarkReport&) = delete;
+
+    static uint32_t Hash(uint32_t hash, const RGBColor& color){
+        hash = (hash ^ color.R) * 16777619u;
+        hash = (hash ^ color.G) * 16777619u;
+
+        return (hash ^ color.B) * 16777619u;
+    }
+
+    void SetRecordMode(bool recordMode){
+        this->recordMode = recordMode;
+    }
+
+    void Begin(){
+        mismatches = 0;
+        unrecorded = 0;
+    }
+
+    //finishes the line of one case with its cost, checksum and result
+    void Report(uint16_t index, float nsPerPixel, uint32_t checksum){
+        checksums[index] = checksum;
+
+        Serial.print(nsPerPixel, 1);
+        Serial.print(" ns/px\t0x");
+        Serial.print(checksum, HEX);
+
+        if (recordMode) Serial.println("\trecorded");
+        else if (references[index] == 0){
+            Serial.println("\tunrecorded");
+            unrecorded++;
+        }
+        else if (references[index] == checksum) Serial.println("\tok");
+        else {
+            Serial.println("\tCHANGED");
+            mismatches++;
+        }
+    }
+
+    //prints the table in record mode, one line per group of cases with the group name as a comment
+    void End(const char* tableName, const char* const* groupNames, uint16_t groupSize){
+        if (!recordMode){
+            if (unrecorded > 0){
+                Serial.print(unrecorded);
+                Serial.println(" cases have no reference on this target, run in record mode once and paste the table");
+            }
+
+            return;
+        }
+
+        Serial.print("static const uint32_t ");
+        Serial.print(tableName);
+        Serial.println("[] = {");
+
+        for (uint16_t i = 0; i < caseCount; i++){
+            Serial.print(" 0x");
+            Serial.print(checksums[i], HEX);
+            Serial.print(",");
+
+            if (i % groupSize == groupSize - 1){
+                Serial.print(" //");
+                Serial.println(groupNames[i / groupSize]);
+            }
+        }
+
+        Serial.println("};");
+    }
+
+    uint16_t GetMismatches(){
+        return mismatches;
+    }
+
+    uint16_t GetUnrecordedCount(){
+        return unrecorded;
+    }
+};
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <Arduino.h>
+#include "BenchmarkReport.h"
+#include "..\..\Camera\Pixels\PixelGroup.h"
+#include "..\..\Camera\Pixels\PixelGroups\P3HUB75Map.h"
+#include "..\..\Camera\Pixels\PixelGroups\WS35PixelsMap.h"
+#include "..\..\Camera\Pixels\PixelGroups\ProtoDR.h"
+#include "..\..\Scene\Screenspace\AfterimageTrail.h"
+#include "..\..\Scene\Screenspace\Bloom.h"
+#include "..\..\Scene\Screenspace\ColorGrading.h"
+#include "..\..\Scene\Screenspace\Fisheye.h"
+#include "..\..\Scene\Screenspace\FrameBlend.h"
+#include "..\..\Scene\Screenspace\GaussianBlur.h"
+#include "..\..\Scene\Screenspace\GlitchX.h"
+#include "..\..\Scene\Screenspace\HorizontalBlur.h"
+#include "..\..\Scene\Screenspace\Magnet.h"
+#include "..\..\Scene\Screenspace\MotionBlur.h"
+#include "..\..\Scene\Screenspace\Overflow.h"
+#include "..\..\Scene\Screenspace\PhaseOffsetR.h"
+#include "..\..\Scene\Screenspace\PhaseOffsetX.h"
+#include "..\..\Scene\Screenspace\PhaseOffsetY.h"
+#include "..\..\Scene\Screenspace\RadialBlur.h"
+#include "..\..\Scene\Screenspace\ShiftR.h"
+#include "..\..\Scene\Screenspace\VerticalBlur.h"
+
+//Applies every screenspace effect to each bundled layout with fixed input frames and a fixed frame clock,
+//reports the cost in ns per pixel and compares a checksum of the output against recorded references
+class EffectBenchmark {
+public:
+    static const uint8_t effectCount = 17;
+    static const uint8_t layoutCount = 4;
+    static const uint8_t ratioCount = 3;
+
+private:
+    PixelGroup<2048> hub75 = PixelGroup<2048>(&P3HUB75Map);
+    PixelGroup<571> ws35 = PixelGroup<571>(&WS35PixelsMap);
+    PixelGroup<306> protoDR = PixelGroup<306>(ProtoDRCamera);
+    PixelGroup<2048> rectangular = PixelGroup<2048>(Vector2D(192.0f, 96.0f), Vector2D(96.0f, 48.0f), 64);
+
+    GlitchX glitchX = GlitchX(20);
+    Fisheye fisheye;
+    Magnet magnet = Magnet(2.0f);
+    RadialBlur radialBlur = RadialBlur(20);
+    PhaseOffsetX phaseOffsetX = PhaseOffsetX(20);
+    PhaseOffsetY phaseOffsetY = PhaseOffsetY(20);
+    PhaseOffsetR phaseOffsetR = PhaseOffsetR(20);
+    ShiftR shiftR = ShiftR(20);
+    HorizontalBlur horizontalBlur = HorizontalBlur(20);
+    VerticalBlur verticalBlur = VerticalBlur(20);
+    GaussianBlur gaussianBlur = GaussianBlur(20);
+    Overflow overflow = Overflow(20);
+    Bloom bloom;
+    FrameBlend frameBlend;
+    AfterimageTrail afterimageTrail;
+    MotionBlur motionBlur;
+    ColorGrading colorGrading;
+
+    Effect* effects[effectCount] = { &glitchX, &fisheye, &magnet, &radialBlur, &phaseOffsetX, &phaseOffsetY, &phaseOffsetR, &shiftR, &horizontalBlur, &verticalBlur, &gaussianBlur, &overflow, &bloom, &frameBlend, &afterimageTrail, &motionBlur, &colorGrading };
+    const char* effectNames[effectCount] = { "GlitchX", "Fisheye", "Magnet", "RadialBlur", "PhaseOffsetX", "PhaseOffsetY", "PhaseOffsetR", "ShiftR", "HorizontalBlur", "VerticalBlur", "GaussianBlur", "Overflow", "Bloom", "FrameBlend", "AfterimageTrail", "MotionBlur", "ColorGrading" };
+    TemporalEffect* temporalEffects[3] = { &frameBlend, &afterimageTrail, &motionBlur };
+
+    IPixelGroup* layouts[layoutCount] = { &hub75, &ws35, &protoDR, &rectangular };
+    const char* layoutNames[layoutCount] = { "P3HUB75", "WS35Pixels", "ProtoDR", "Rect64x32" };
+
+    const float ratios[ratioCount] = { 0.25f, 0.5f, 1.0f };
+
+    FrameContext frame = FrameContext(0x5EED);
+    BenchmarkReport report;
+
+    //one checksum per effect, layout and ratio, paste the table printed in record mode over the one of the target
+    static const uint32_t* GetReferences(){
+#if defined(ARDUINO)
+        static const uint32_t references[effectCount * layoutCount * ratioCount] = { 0 };//not recorded on hardware yet
+#else
+        //desktop build, g++ on x86-64
+        static const uint32_t references[effectCount * layoutCount * ratioCount] = {
+            0xCBFA31FE, 0xF8DA66F9, 0x519E5BED, 0x12846842, 0xC9DCBADE, 0xD254E5A6, 0xFD7F2C11, 0x70E234C3, 0xB87DF538, 0x5C930D2D, 0xB80B7B3E, 0x2E75C6F1, //GlitchX
+            0x1CCBCA56, 0x86C08AF, 0x7F2AFBF7, 0x142D7F8, 0x92D05657, 0x77F5545F, 0xEE8DB20F, 0xA77691C3, 0x6D626BC, 0xF44DE556, 0xC5138388, 0x4F0E269D, //Fisheye
+            0x5586E87, 0x5586E87, 0x5586E87, 0x579D5564, 0x579D5564, 0x579D5564, 0xD5BA6B87, 0xD5BA6B87, 0xD5BA6B87, 0xD83F7775, 0xD83F7775, 0xD83F7775, //Magnet
+            0x27091D3D, 0xC8BC3909, 0x26060235, 0x89205EAC, 0x166DA952, 0x6F9F7E61, 0x562AF999, 0x67B72506, 0x3532F661, 0x6BC61D27, 0xDF79B32D, 0x6D7633EF, //RadialBlur
+            0x2E656236, 0xB0CCCD8B, 0x6D49F41E, 0x5EDDC97, 0x6889A217, 0x330EDB9A, 0xC3A7AA39, 0x5E9AF083, 0xF9DFC2F3, 0xB30A844E, 0x62A60119, 0x1279E6F3, //PhaseOffsetX
+            0x79A2651, 0x45853B64, 0xE3175CFC, 0x7EA792EA, 0xD3419280, 0xA1710C5E, 0xE9700724, 0x485212A2, 0x513F2C27, 0x24208450, 0xA674FD2C, 0xA3512705, //PhaseOffsetY
+            0xA4476156, 0x62CECFC3, 0xA91D5348, 0xAC61F6E5, 0x1346A701, 0x58E05932, 0xFFAF7CB2, 0x4692D414, 0xE29C651E, 0x35569088, 0x4CE09E80, 0x947C29E8, //PhaseOffsetR
+            0x79F038BE, 0x7408A98F, 0xF11F6746, 0x23F76EE0, 0x8628D1EA, 0x37DCCDEB, 0xE419007, 0x169EC70F, 0x6F590929, 0xA0AFB6BD, 0x3EFF55D4, 0xF8C406A0, //ShiftR
+            0x4CDBB3EC, 0x4DD32BB0, 0xA0F5D1A7, 0x734406E7, 0x4E79B6C1, 0xAE67D2CB, 0x6B58538E, 0xB4FAEFD3, 0xFD681C94, 0xEB94DB1B, 0x8CF87D85, 0xCED99C4D, //HorizontalBlur
+            0xCEEC9002, 0x40F15C49, 0x48F61419, 0x5228B900, 0x18224F21, 0xF22FDAED, 0xDF9DA6C4, 0x5F3150DD, 0xCA072E2B, 0x1770389B, 0xF274B9DA, 0xCEC4328D, //VerticalBlur
+            0xF3062CF7, 0x8A9CFC16, 0xF6FDEFC1, 0xDE3A6308, 0xE4BFCE78, 0xEED33873, 0xE11D50E8, 0x414DF23A, 0xDE10E5A, 0x651CC0E9, 0x4FD526FA, 0x9AD1D7AA, //GaussianBlur
+            0x3CD9BF98, 0x3CD9BF98, 0x3CD9BF98, 0xA41E8D09, 0xA41E8D09, 0xA41E8D09, 0xAFB49593, 0xAFB49593, 0xAFB49593, 0x462914D8, 0x462914D8, 0x462914D8, //Overflow
+            0x4BEFFB3C, 0x632FF931, 0x49E2A3B2, 0xDA6319D4, 0x6418A5A4, 0x31F18DFE, 0x3FB0F12E, 0x1421F2A9, 0x1D3DC757, 0x62FD9A6D, 0xE8EFE091, 0x3B60A5C1, //Bloom
+            0x22864EBE, 0xA977AEF, 0x6C8510D6, 0x8A7BCD9A, 0x2F255B04, 0xDAE14957, 0x41C5A1F, 0x17CB1080, 0xCB6B32AF, 0xBC4FD10E, 0x549C12D1, 0x5F8BCF4, //FrameBlend
+            0xEE7C324D, 0x9F2387B1, 0x2711C636, 0x3AD84403, 0x5E3E333D, 0x8E269E97, 0x4491AC90, 0x48E5B5C0, 0x76C068A9, 0xC59BF41, 0xDE399087, 0xA504A65A, //AfterimageTrail
+            0x8AE62B41, 0x5204F02A, 0xFAA1D7EB, 0xE8349496, 0x7668D2EB, 0xB43F43B5, 0x787E465A, 0x8E3774A9, 0xF1B3E820, 0x6AB55B15, 0x6FEF25E9, 0x970B0036, //MotionBlur
+            0x3A6F9BFB, 0xA75D0BFA, 0x5DFD1495, 0x5F43F577, 0xE5C639E5, 0x3E43E475, 0x6B45A7E7, 0xA86BF0DC, 0xF762626A, 0xF7A1A50C, 0x6DBEB855, 0x438D356F //ColorGrading
+        };
+#endif
+
+        return references;
+    }
+
+    //soft gradients with a few saturated spots, so blurs, thresholds and warps all have something to move
+    //the back buffer is cleared too, so pixels an effect leaves unwritten do not carry over from the previous case
+    static void FillInput(IPixelGroup* pixelGroup, uint8_t step){
+        RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
+        Vector2D minimum = pixelGroup->GetCenterCoordinate() - pixelGroup->GetSize() / 2.0f;
+        Vector2D size = pixelGroup->GetSize();
+
+        for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
+            Vector2D location = pixelGroup->GetCoordinate(i) - minimum;
+            float x = size.X > 0.0f ? location.X / size.X : 0.0f;
+            float y = size.Y > 0.0f ? location.Y / size.Y : 0.0f;
+            bool spot = (i * 2654435761u + step * 40503u) % 97 == 0;
+
+            colorBuffer[i] = RGBColor();
+            *pixelGroup->GetColor(i) = spot ? RGBColor(255, 255, 255) : RGBColor(uint8_t(x * 255.0f), uint8_t(y * 255.0f), uint8_t((i + step * 7) % 64));
+        }
+    }
+
+    static uint32_t Checksum(IPixelGroup* pixelGroup){
+        uint32_t hash = BenchmarkReport::hashStart;
+
+        for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
+            hash = BenchmarkReport::Hash(hash, *pixelGroup->GetColor(i));
+        }
+
+        return hash;
+    }
+
+public:
+    EffectBenchmark() : report(GetReferences(), effectCount * layoutCount * ratioCount) {
+        colorGrading.SetHueShift(40.0f);
+        colorGrading.SetSaturation(1.3f);
+        colorGrading.SetContrast(1.1f);
+    }
+
+    //prints the checksum table instead of comparing, paste it into GetReferences after a deliberate visual change
+    void SetRecordMode(bool recordMode){
+        report.SetRecordMode(recordMode);
+    }
+
+    //each case restarts from the same clock, seed and input so its output only depends on the effect code, returns the number of mismatches
+    uint16_t Run(uint8_t frames = 8){
+        report.Begin();
+
+        for (uint8_t e = 0; e < effectCount; e++){
+            for (uint8_t l = 0; l < layoutCount; l++){
+                for (uint8_t r = 0; r < ratioCount; r++){
+                    IPixelGroup* pixelGroup = layouts[l];
+                    Effect* effect = effects[e];
+                    uint16_t index = (e * layoutCount + l) * ratioCount + r;
+                    uint32_t elapsed = 0;
+
+                    for (uint8_t i = 0; i < 3; i++){
+                        temporalEffects[i]->Reset();
+                    }
+
+                    frame.Reset(1000000);
+                    effect->SetRatio(ratios[r]);
+
+                    for (uint8_t f = 0; f < frames; f++){
+                        FillInput(pixelGroup, f);
+
+                        frame.Step(1.0f / 60.0f);
+
+                        uint32_t start = micros();
+
+                        effect->ApplyEffect(pixelGroup, &frame);
+
+                        elapsed += micros() - start;
+                    }
+
+                    float nsPerPixel = float(elapsed) * 1000.0f / float(frames) / float(pixelGroup->GetPixelCount());
+
+                    Serial.print(effectNames[e]);
+                    Serial.print("\t");
+                    Serial.print(layoutNames[l]);
+                    Serial.print("\t");
+                    Serial.print(ratios[r], 2);
+                    Serial.print("\t");
+
+                    report.Report(index, nsPerPixel, Checksum(pixelGroup));
+                }
+            }
+        }
+
+        report.End("references", effectNames, layoutCount * ratioCount);
+
+        return report.GetMismatches();
+    }
+};
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <Arduino.h>
+#include "BenchmarkReport.h"
+#include "..\..\Scene\Materials\Static\GradientMaterial.h"
+#include "..\..\Scene\Materials\Static\Image.h"
+#include "..\..\Scene\Materials\Static\SimplexNoise.h"
+#include "..\..\Scene\Materials\Static\SpiralMaterial.h"
+#include "..\..\Scene\Materials\Static\SimpleMaterial.h"
+#include "..\..\Scene\Materials\CombineMaterial.h"
+#include "..\..\Scene\Materials\ComposeMaterial.h"
+
+//Samples each material over a fixed grid of positions, reports the cost in ns per pixel and compares a checksum
+//of the colors against recorded references, run it before and after a change to a material to compare the cost
+class MaterialBenchmark {
+public:
+    static const uint8_t materialCount = 12;
+    static const uint8_t gridWidth = 64;
+    static const uint8_t gridHeight = 32;
+
+private:
+    RGBColor gradientColors[4] = { RGBColor(255, 0, 0), RGBColor(0, 255, 0), RGBColor(0, 0, 255), RGBColor(255, 255, 0) };
+    RGBColor spiralColors[4] = { RGBColor(255, 0, 255), RGBColor(0, 255, 255), RGBColor(255, 128, 0), RGBColor(0, 0, 0) };
+    uint8_t imagePalette[12] = { 0, 0, 0, 255, 64, 0, 0, 128, 255, 255, 255, 255 };
+    uint8_t imageData[32 * 32];
+
+    GradientMaterial<4> gradient = GradientMaterial<4>(gradientColors, 40.0f, false);
+    GradientMaterial<4> gradientRotated = GradientMaterial<4>(gradientColors, 40.0f, false);
+    GradientMaterial<4> gradientRadial = GradientMaterial<4>(gradientColors, 40.0f, true);
+    SpiralMaterial spiral = SpiralMaterial(4, spiralColors, 3.0f, 7.0f);
+    Image image = Image(imageData, imagePalette, 32, 32, 12);
+    Image imageRotated = Image(imageData, imagePalette, 32, 32, 12);
+    Image imageBilinear = Image(imageData, imagePalette, 32, 32, 12);
+    Image imageMip = Image(imageData, imagePalette, 32, 32, 12);
+    GradientMaterial<4> noiseGradient = GradientMaterial<4>(gradientColors, 2.0f, false);
+    SimplexNoise<4> noise = SimplexNoise<4>(1, &noiseGradient);
+    SimplexNoise<4> noiseGrid = SimplexNoise<4>(1, &noiseGradient);
+    SimpleMaterial layerColor = SimpleMaterial(RGBColor(0, 64, 255));
+
+    //the same stack through both layer materials, their checksums must match
+    CombineMaterial<4> combine;
+    ComposeMaterial<BlendAdd<GradientMaterial<4>>, BlendLighten<SpiralMaterial>, BlendReplace<Image>, BlendSubtract<SimpleMaterial>> compose = {
+        &gradientRotated,
+        BlendLighten<SpiralMaterial>(&spiral, 0.6f),
+        BlendReplace<Image>(&imageRotated, 0.5f),
+        BlendSubtract<SimpleMaterial>(&layerColor, 0.3f)
+    };
+
+    Material* materials[materialCount] = { &gradient, &gradientRotated, &gradientRadial, &spiral, &image, &imageRotated, &imageBilinear, &imageMip, &noise, &noiseGrid, &combine, &compose };
+    const char* materialNames[materialCount] = { "Gradient", "GradientRotated", "GradientRadial", "SpiralRotated", "Image", "ImageRotated", "ImageBilinear", "ImageMip", "Noise", "NoiseGrid", "Combine", "Compose" };
+
+    BenchmarkReport report;
+
+    //checksums recorded by a run in record mode, one table per target
+    static const uint32_t* GetReferences(){
+#if defined(ARDUINO)
+        static const uint32_t references[materialCount] = { 0 };//not recorded on hardware yet
+#else
+        //desktop build, g++ on x86-64
+        static const uint32_t references[materialCount] = {
+            0xBC76D045, //Gradient
+            0xCAFF3684, //GradientRotated
+            0x733D7BAA, //GradientRadial
+            0x992D1C01, //SpiralRotated
+            0xADE4CE6B, //Image
+            0x9EB53BE6, //ImageRotated
+            0xBBA1CBF3, //ImageBilinear
+            0x509A6945, //ImageMip
+            0xBDC42563, //Noise
+            0xA211C4A7, //NoiseGrid
+            0xB00B30EF, //Combine
+            0xB00B30EF, //Compose
+        };
+#endif
+
+        return references;
+    }
+
+    static Vector3D GetPosition(uint16_t x, uint16_t y){//192 by 96 area around the origin, the size of the bundled panels
+        return Vector3D(float(x) * 3.0f - 96.0f, float(y) * 3.0f - 48.0f, 0.0f);
+    }
+
+public:
+    MaterialBenchmark() : report(GetReferences(), materialCount) {
+        for (uint16_t i = 0; i < 32 * 32; i++){
+            imageData[i] = ((i % 32) / 8 + (i / 32) / 8) % 4;//checker of all four palette entries
+        }
+
+        gradientRotated.SetRotationAngle(30.0f);
+        gradientRadial.SetRotationAngle(15.0f);
+        gradientRadial.SetPositionOffset(Vector2D(10.0f, -5.0f));
+        spiral.SetRotationAngle(45.0f);
+        spiral.SetPositionOffset(Vector2D(5.0f, 5.0f));
+        image.SetSize(Vector2D(120.0f, 80.0f));
+        imageRotated.SetSize(Vector2D(120.0f, 80.0f));
+        imageRotated.SetPosition(Vector2D(8.0f, 4.0f));
+        imageRotated.SetRotation(20.0f);
+        imageBilinear.SetSize(Vector2D(120.0f, 80.0f));
+        imageBilinear.SetRotation(20.0f);
+        imageBilinear.SetFilter(Texture::Bilinear);
+        imageMip.SetSize(Vector2D(24.0f, 16.0f));//shrunk and tiled, about four texels per sample
+        imageMip.SetWrap(Texture::Repeat);
+        imageMip.SetFilter(Texture::Bilinear);
+        imageMip.SetPixelSpacing(3.0f);
+        noise.SetScale(Vector3D(0.007f, 0.007f, 0.007f));
+        noiseGrid.SetScale(Vector3D(0.007f, 0.007f, 0.007f));
+        noiseGrid.SetQuality(0.5f, Vector2D(-96.0f, -48.0f), Vector2D(96.0f, 48.0f));
+        combine.AddMaterial(Material::Add, &gradientRotated, 1.0f);
+        combine.AddMaterial(Material::Lighten, &spiral, 0.6f);
+        combine.AddMaterial(Material::Replace, &imageRotated, 0.5f);
+        combine.AddMaterial(Material::Subtract, &layerColor, 0.3f);
+    }
+
+    //prints the checksum table instead of comparing, paste it into GetReferences after a deliberate visual change
+    void SetRecordMode(bool recordMode){
+        report.SetRecordMode(recordMode);
+    }
+
+    //returns the number of mismatches
+    uint16_t Run(uint8_t frames = 8){
+        uint32_t combineHash = 0;
+        uint32_t composeHash = 0;
+
+        report.Begin();
+
+        for (uint8_t m = 0; m < materialCount; m++){
+            Material* material = materials[m];
+            uint32_t hash = BenchmarkReport::hashStart;
+            uint32_t elapsed = 0;
+
+            for (uint8_t f = 0; f < frames; f++){
+                noise.SetZPosition(float(f) * 0.01f);//animated like the noise backgrounds, the grid is rebuilt every frame
+                noiseGrid.SetZPosition(float(f) * 0.01f);
+
+                for (uint16_t y = 0; y < gridHeight; y++){
+                    uint32_t start = micros();
+
+                    for (uint16_t x = 0; x < gridWidth; x++){
+                        RGBColor color = material->GetRGB(GetPosition(x, y), Vector3D(), Vector3D());
+
+                        if (f == 0) hash = BenchmarkReport::Hash(hash, color);//checksum of the first pass
+                    }
+
+                    elapsed += micros() - start;
+                }
+            }
+
+            if (material == &combine) combineHash = hash;
+            if (material == &compose) composeHash = hash;
+
+            float nsPerPixel = float(elapsed) * 1000.0f / float(frames) / float(gridWidth * gridHeight);
+
+            Serial.print(materialNames[m]);
+            Serial.print("\t");
+
+            report.Report(m, nsPerPixel, hash);
+        }
+
+        report.End("references", materialNames, 1);
+
+        if (combineHash != composeHash){
+            Serial.println("Compose differs from Combine");
+
+            return report.GetMismatches() + 1;
+        }
+
+        return report.GetMismatches();
+    }
+};
@@ -223,9 +223,13 @@ public:
 		this->subEffect = effect;
 	}
 
+	bool IsActive() override {//always observes the pixels, even when the wrapped effect is off
+		return true;
+	}
+
 	void ApplyEffect(IPixelGroup* pixelGroup){
 		//Actually apply effect
-		subEffect->ApplyEffect(pixelGroup);
+		if (subEffect->IsActive()) subEffect->ApplyEffect(pixelGroup, frame);
 		
         unsigned int pixelCount = pixelGroup->GetPixelCount();
 		
@@ -5,6 +5,7 @@
 #include "..\..\..\Scene\Materials\Special\Overlays\Text\TextEngine.h"
 
 #include "..\..\..\Animation\AnimationTracks\EffectChangeTrack.h"
+#include "..\..\..\Scene\Screenspace\EffectTransition.h"
 #include "..\..\..\Scene\Screenspace\Passthrough.h"
 #include "..\..\..\Scene\Screenspace\GlitchX.h"
 #include "..\..\..\Scene\Screenspace\Fisheye.h"
@@ -87,6 +88,7 @@ private:
     static EffectChangeTrack<1> effectChange;
     static float effectStrength;
     static uint8_t previousMenu;
+    static EffectTransition effectTransition;
     
     static Passthrough passthrough;
     static Fisheye fisheye;
@@ -228,6 +230,11 @@ public:
         }
     }
 
+    //crossfades to the selected effect when the menu selection changes
+    static Effect* GetEffectTransition(){
+        return &effectTransition;
+    }
+
     static void SetCurrentMenu(uint8_t currentMenu){
         Menu::currentMenu = currentMenu;
     }
@@ -272,6 +279,8 @@ public:
         effectChange.Update();
 
         GetEffect()->SetRatio(effectStrength);
+
+        effectTransition.SetEffect(GetEffect());
     }
 
     static void SetWiggleRatio(float wiggleRatio){
@@ -557,6 +566,7 @@ uint8_t Menu::fanSpeed = 0;
 EffectChangeTrack<1> Menu::effectChange;
 float Menu::effectStrength = 0.0f;
 uint8_t Menu::previousMenu = 0;
+EffectTransition Menu::effectTransition = EffectTransition(0.5f);
 
 Passthrough Menu::passthrough = Passthrough();
 Fisheye Menu::fisheye = Fisheye();
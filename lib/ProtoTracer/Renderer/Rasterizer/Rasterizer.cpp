@@ -40,6 +40,8 @@ RGBColor Rasterizer::CheckRasterPixel(Triangle2D** triangles, int numTriangles,
 void Rasterizer::Rasterize(Scene* scene, CameraBase* camera) {
     if (camera->Is2D()) {
         for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++) {
+            if (!pixelGroup->IsSampled(i)) continue;
+
             Vector2D pixelRay = pixelGroup->GetCoordinate(i);
             Vector3D pixelRay3D = Vector3D(pixelRay.X, pixelRay.Y, 0) + transform->GetPosition();
 
@@ -75,6 +77,8 @@ void Rasterizer::Rasterize(Scene* scene, CameraBase* camera) {
         tree.Rebuild();
 
         for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++) {
+            if (!pixelGroup->IsSampled(i)) continue;
+
             Vector2D pixelRay = Vector2D(lookDirection.RotateVectorUnit(pixelGroup->GetCoordinate(i) * transform->GetScale(), normLookDir));
             Node* leafNode = tree.Intersect(pixelRay);
 
@@ -92,4 +96,6 @@ void Rasterizer::Rasterize(Scene* scene, CameraBase* camera) {
             pixelGroup->GetColor(i)->B = color.B;
         }
     }
+
+    pixelGroup->Upscale();
 }
@@ -35,14 +35,17 @@ float* AudioReactiveGradient::GetFourierData() {
 
 void AudioReactiveGradient::SetSize(Vector2D size) {
     this->size = size.Divide(2.0f);
+    dirty = true;
 }
 
 void AudioReactiveGradient::SetPosition(Vector2D offset) {
     this->offset = offset;
+    dirty = true;
 }
 
 void AudioReactiveGradient::SetRotation(float angle) {
     this->angle = angle;
+    dirty = true;
 }
 
 void AudioReactiveGradient::SetHueAngle(float hueAngle) {
@@ -63,10 +66,34 @@ void AudioReactiveGradient::Update(float* readData) {
             bounceData[i] = data[i];
         }
     }
+
+    dirty = true;
+}
+
+void AudioReactiveGradient::UpdateUniforms() {
+    float radians = angle * Mathematics::MPID180;
+
+    rotate = !Mathematics::IsClose(angle, 0.0f, 0.1f);
+    cs = cosf(radians);
+    sn = sinf(radians);
+    binWidth = size.X / float(bins);
+    heights = bounce ? bounceData : data;
+
+    dirty = false;
+}
+
+void AudioReactiveGradient::Prepare(FrameContext* frame) {
+    if (dirty) UpdateUniforms();
+
+    material->PrepareFrame(frame);
 }
 
 RGBColor AudioReactiveGradient::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) {
-    Vector2D rPos = Mathematics::IsClose(angle, 0.0f, 0.1f) ? Vector2D(position.X, position.Y) - offset : Vector2D(position.X, position.Y).Rotate(angle, offset) - offset;
+    if (dirty) UpdateUniforms();//not prepared by the engine this frame
+
+    Vector2D rPos = Vector2D(position.X, position.Y) - offset;
+
+    if (rotate) rPos = Vector2D(rPos.X * cs - rPos.Y * sn + offset.X, rPos.X * sn + rPos.Y * cs + offset.Y) - offset;//rounds the same as Rotate(angle, offset) - offset
 
     // Outside of size bounds
     if (-size.X > rPos.X && size.X < rPos.X) return RGBColor();
@@ -81,10 +108,10 @@ RGBColor AudioReactiveGradient::GetRGB(Vector3D position, Vector3D normal, Vecto
 
     if (bins > x && 0 > x) return RGBColor();
 
-    float xDistance = size.X / float(bins) * x - size.X;
-    float xDistance2 = size.X / float(bins) * (x + 1) - size.X;
+    float xDistance = binWidth * x - size.X;
+    float xDistance2 = binWidth * (x + 1) - size.X;
     float ratio = Mathematics::Map(rPos.X, xDistance, xDistance2, 0.0f, 1.0f); // ratio between two bins
-    float height = bounce ? Mathematics::CosineInterpolation(bounceData[x], bounceData[x + 1], ratio) : Mathematics::CosineInterpolation(data[x], data[x + 1], ratio); // 0->1.0f of max height of color
+    float height = Mathematics::CosineInterpolation(heights[x], heights[x + 1], ratio); // 0->1.0f of max height of color
 
     float yColor = Mathematics::Map(rPos.Y, 0.0f, size.Y, 1.0f, 0.0f);
 
@@ -13,9 +13,17 @@ private:
     float hueAngle = 0.0f;
     float radius = 0.0f;
     uint8_t colors;
-    float* data;
+    float* data = nullptr;
     float bounceData[128];
     uint8_t bins = 128;
+
+    //per frame terms shared by every pixel, rebuilt when a setter or Update changed them
+    float* heights = bounceData;
+    float binWidth = 0.0f;
+    float cs = 1.0f;
+    float sn = 0.0f;
+    bool rotate = false;
+    bool dirty = true;
     bool bounce = false;
     bool circular = false;
 
@@ -24,6 +32,8 @@ private:
 
     Material* material;
 
+    void UpdateUniforms();
+
 public:
     AudioReactiveGradient(Vector2D size, Vector2D offset, bool bounce = false, bool circular = false);
     ~AudioReactiveGradient();
@@ -37,5 +47,7 @@ public:
     void SetRadius(float radius);
     void Update(float* readData);
 
+    void Prepare(FrameContext* frame) override;
+
     RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override;
 };
@@ -5,6 +5,10 @@ void FlowNoise::SetGradient(RGBColor color, uint8_t colorIndex) {
     gNoiseMat.UpdateGradient(noiseSpectrum);
 }
 
+void FlowNoise::SetQuality(float quality, Vector2D minimum, Vector2D maximum) {
+    sNoise.SetQuality(quality, minimum, maximum);
+}
+
 void FlowNoise::Update(float ratio) {
     float sweepX = fGenMatGradientX.Update();
     float sweepY = fGenMatGradientY.Update();
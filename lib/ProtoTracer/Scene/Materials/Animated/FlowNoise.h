@@ -20,6 +20,7 @@ public:
     FlowNoise(){}
 
     void SetGradient(RGBColor color, uint8_t colorIndex);
+    void SetQuality(float quality, Vector2D minimum, Vector2D maximum);//see SimplexNoise::SetQuality
     void Update(float ratio);
     Material* GetMaterial();
     RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override;
@@ -23,14 +23,17 @@ float* Oscilloscope::GetSampleData() {
 
 void Oscilloscope::SetSize(Vector2D size) {
     this->size = size.Divide(2.0f);
+    dirty = true;
 }
 
 void Oscilloscope::SetPosition(Vector2D offset) {
     this->offset = offset;
+    dirty = true;
 }
 
 void Oscilloscope::SetRotation(float angle) {
     this->angle = angle;
+    dirty = true;
 }
 
 void Oscilloscope::SetHueAngle(float hueAngle) {
@@ -44,10 +47,39 @@ void Oscilloscope::Update(float* data) {
     maxValue = maxF.Filter(data[bins / 2 + 1]);
 
     midPoint = (maxValue - minValue) / 2.0f + minValue;
+
+    dirty = true;
+}
+
+void Oscilloscope::UpdateUniforms() {
+    float radians = angle * Mathematics::MPID180;
+
+    rotate = !Mathematics::IsClose(angle, 0.0f, 0.1f);
+    cs = cosf(radians);
+    sn = sinf(radians);
+    binWidth = size.X / float(bins);
+
+    if (data) {
+        for (uint8_t i = 0; i < bins + 2; i++) {
+            points[i] = Mathematics::Map(data[i], minValue, maxValue, 0.0f, 0.75f);
+        }
+    }
+
+    dirty = false;
+}
+
+void Oscilloscope::Prepare(FrameContext* frame) {
+    if (dirty) UpdateUniforms();
+
+    material->PrepareFrame(frame);
 }
 
 RGBColor Oscilloscope::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) {
-    Vector2D rPos = Mathematics::IsClose(angle, 0.0f, 0.1f) ? Vector2D(position.X, position.Y) - offset : Vector2D(position.X, position.Y).Rotate(angle, offset) - offset;
+    if (dirty) UpdateUniforms();//not prepared by the engine this frame
+
+    Vector2D rPos = Vector2D(position.X, position.Y) - offset;
+
+    if (rotate) rPos = Vector2D(rPos.X * cs - rPos.Y * sn + offset.X, rPos.X * sn + rPos.Y * cs + offset.Y) - offset;//rounds the same as Rotate(angle, offset) - offset
 
     // Outside of size bounds
     if (rPos.X < -size.X || rPos.X > size.X) return RGBColor();
@@ -57,14 +89,11 @@ RGBColor Oscilloscope::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw)
 
     if (bins > x && 0 > x) return RGBColor();
 
-    float xDistance = size.X / float(bins) * x - size.X;
-    float xDistance2 = size.X / float(bins) * (x + 2) - size.X;
+    float xDistance = binWidth * x - size.X;
+    float xDistance2 = binWidth * (x + 2) - size.X;
     float ratio = Mathematics::Map(rPos.X, xDistance, xDistance2, 0.0f, 1.0f); // ratio between two bins
 
-    float firstPoint = Mathematics::Map(data[x], minValue, maxValue, 0.0f, 0.75f);
-    float secondPoint = Mathematics::Map(data[x + 2], minValue, maxValue, 0.0f, 0.75f);
-
-    float height = Mathematics::CosineInterpolation(firstPoint, secondPoint, ratio); // 0->1.0f of max height of color
+    float height = Mathematics::CosineInterpolation(points[x], points[x + 2], ratio); // 0->1.0f of max height of color
     float yColor = Mathematics::Map(rPos.Y, 0.0f, size.Y, 1.0f, 0.0f);
 
     if (rPos.Y < height * size.Y / 2.0f && rPos.Y > height * size.Y / 2.0f - size.Y * 0.1f) {
@@ -15,10 +15,18 @@ private:
     float hueAngle = 0.0f;
     float radius = 40.0f;
     uint8_t colors;
-    float* data;
+    float* data = nullptr;
     float midPoint = 0.0f;
     uint8_t bins = 128;
 
+    //per frame terms shared by every pixel, rebuilt when a setter or Update changed them
+    float points[130];//scaled sample heights, GetRGB reads up to bins + 1
+    float binWidth = 0.0f;
+    float cs = 1.0f;
+    float sn = 0.0f;
+    bool rotate = false;
+    bool dirty = true;
+
     MaxFilter<40> maxF = MaxFilter<40>();
     MinFilter<40> minF = MinFilter<40>();
 
@@ -29,6 +37,8 @@ private:
 
     float minValue, maxValue;
 
+    void UpdateUniforms();
+
 public:
     Oscilloscope(Vector2D size, Vector2D offset);
     ~Oscilloscope();
@@ -41,5 +51,7 @@ public:
     void SetHueAngle(float hueAngle);
     void Update(float* data);
 
+    void Prepare(FrameContext* frame) override;
+
     RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override;
 };
@@ -16,6 +16,7 @@ private:
 public:
     RainbowNoise() {}
 
+    void SetQuality(float quality, Vector2D minimum, Vector2D maximum);//see SimplexNoise::SetQuality
     void Update(float ratio);
     Material* GetMaterial();
     RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override;
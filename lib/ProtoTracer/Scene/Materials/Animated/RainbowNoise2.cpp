@@ -1,5 +1,9 @@
 #include "RainbowNoise2.h"
 
+void RainbowNoise2::SetQuality(float quality, Vector2D minimum, Vector2D maximum) {
+    sNoise.SetQuality(quality, minimum, maximum);
+}
+
 void RainbowNoise2::Update(float ratio) {
     float sweep = fGenMatGradient.Update();
     float sShift = sweep * 0.004f + 0.005f;
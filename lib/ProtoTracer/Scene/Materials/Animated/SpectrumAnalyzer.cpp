@@ -43,14 +43,17 @@ float* SpectrumAnalyzer::GetFourierData() {
 
 void SpectrumAnalyzer::SetSize(Vector2D size) {
     this->size = size.Divide(2.0f);
+    dirty = true;
 }
 
 void SpectrumAnalyzer::SetPosition(Vector2D offset) {
     this->offset = offset;
+    dirty = true;
 }
 
 void SpectrumAnalyzer::SetRotation(float angle) {
     this->angle = angle;
+    dirty = true;
 }
 
 void SpectrumAnalyzer::SetHueAngle(float hueAngle) {
@@ -67,22 +70,48 @@ void SpectrumAnalyzer::Update(float* readData) {
             bounceData[i] = data[i];
         }
     }
+
+    dirty = true;
+}
+
+void SpectrumAnalyzer::UpdateUniforms() {
+    float radians = angle * Mathematics::MPID180;
+
+    rotate = !Mathematics::IsClose(angle, 0.0f, 0.1f);
+    cs = cosf(radians);
+    sn = sinf(radians);
+    binWidth = size.X / float(bins);
+    heights = bounce ? bounceData : data;
+
+    dirty = false;
+}
+
+void SpectrumAnalyzer::Prepare(FrameContext* frame) {
+    if (dirty) UpdateUniforms();
+
+    material->PrepareFrame(frame);
 }
 
 RGBColor SpectrumAnalyzer::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) {
-    Vector2D rPos = Mathematics::IsClose(angle, 0.0f, 0.1f) ? Vector2D(position.X, position.Y) - offset : Vector2D(position.X, position.Y).Rotate(angle, offset) - offset;
+    if (dirty) UpdateUniforms();//not prepared by the engine this frame
+
+    Vector2D rPos = Vector2D(position.X, position.Y) - offset;
+
+    if (rotate) rPos = Vector2D(rPos.X * cs - rPos.Y * sn + offset.X, rPos.X * sn + rPos.Y * cs + offset.Y) - offset;//rounds the same as Rotate(angle, offset) - offset
 
     if (-size.X > rPos.X && size.X < rPos.X) return RGBColor();
     if (-size.Y > rPos.Y && size.Y < rPos.Y) return RGBColor();
 
     uint8_t x = uint8_t(Mathematics::Map(rPos.X, -size.X, size.X, float(bins), 0.0f));
 
-    if (bins > x && 0 > x) return RGBColor();
+    if (x >= bins) return RGBColor();
+
+    uint8_t next = x + 1 < bins ? x + 1 : bins - 1;//the last bin blends with itself
 
-    float xDistance = size.X / float(bins) * x - size.X;
-    float xDistance2 = size.X / float(bins) * (x + 1) - size.X;
+    float xDistance = binWidth * x - size.X;
+    float xDistance2 = binWidth * (x + 1) - size.X;
     float ratio = Mathematics::Map(rPos.X, xDistance, xDistance2, 0.0f, 1.0f); // ratio between two bins
-    float height = bounce ? Mathematics::CosineInterpolation(bounceData[x], bounceData[x + 1], ratio) : Mathematics::CosineInterpolation(data[x], data[x + 1], ratio); // 0->1.0f of max height of color
+    float height = Mathematics::CosineInterpolation(heights[x], heights[next], ratio); // 0->1.0f of max height of color
     float yColor;
 
     height = height * 3.0f;
@@ -12,9 +12,17 @@ private:
     float angle = 0.0f;
     float hueAngle = 0.0f;
     uint8_t colors;
-    float* data;
+    float* data = nullptr;
     float bounceData[128];
     uint8_t bins = 128;
+
+    //per frame terms shared by every pixel, rebuilt when a setter or Update changed them
+    float* heights = bounceData;
+    float binWidth = 0.0f;
+    float cs = 1.0f;
+    float sn = 0.0f;
+    bool rotate = false;
+    bool dirty = true;
     bool mirrorY = false;
     bool flipY = false;
     bool bounce = false;
@@ -24,6 +32,8 @@ private:
 
     Material* material;
 
+    void UpdateUniforms();
+
 public:
     SpectrumAnalyzer(Vector2D size, Vector2D offset, bool bounce = false, bool flipY = false, bool mirrorY = false);
     ~SpectrumAnalyzer();
@@ -38,5 +48,7 @@ public:
     void SetHueAngle(float hueAngle);
     void Update(float* readData);
 
+    void Prepare(FrameContext* frame) override;
+
     RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override;
 };
@@ -7,4 +7,10 @@ public:
     virtual void Update(float ratio);
 
     virtual Material* GetMaterial();
+
+    void Prepare(FrameContext* frame) override {
+        Material* material = GetMaterial();
+
+        if (material && material != this) material->PrepareFrame(frame);
+    }
 };
@@ -2,6 +2,7 @@
 
 #include "Material.h"
 #include "..\..\Utils\Math\Vector2D.h"
+#include "..\..\Utils\PixelKernels.h"
 
 template<size_t materialCount>
 class CombineMaterial : public Material {
@@ -9,7 +10,16 @@ private:
     Method method[materialCount];
     Material* materials[materialCount];
     float opacity[materialCount];
+    uint16_t weight[materialCount];//opacity out of 256 for the integer blends
     uint8_t materialsAdded = 0;
+    uint8_t layers[materialCount];//indices of the layers that can change the output, rebuilt when a layer changes
+    uint8_t layerCount = 0;
+    bool dirty = true;
+
+    void Compile();
+
+    static uint8_t BlendChannel(Method method, float base, float layer);
+    static RGBColor BlendColors(Method method, const RGBColor& base, const RGBColor& layer);
 
 public:
     CombineMaterial() {}
@@ -19,29 +29,48 @@ public:
             this->method[materialsAdded] = method;
             this->materials[materialsAdded] = material;
             this->opacity[materialsAdded] = opacity;
+            this->weight[materialsAdded] = PixelKernels::GetWeight(opacity);
 
             materialsAdded++;
+            dirty = true;
         }
     }
 
     void SetMethod(uint8_t index, Method method) {
-        if (index < materialsAdded) {
+        if (index < materialsAdded && this->method[index] != method) {
             this->method[index] = method;
+            dirty = true;
         }
     }
 
     void SetOpacity(uint8_t index, float opacity) {
-        if (index < materialsAdded) {
+        if (index < materialsAdded && this->opacity[index] != opacity) {
             this->opacity[index] = opacity;
+            this->weight[index] = PixelKernels::GetWeight(opacity);
+            dirty = true;
         }
     }
 
     void SetMaterial(uint8_t index, Material* material) {
-        if (index < materialsAdded) {
+        if (index < materialsAdded && materials[index] != material) {
             materials[index] = material;
+            dirty = true;
+        }
+    }
+
+    void Prepare(FrameContext* frame) override {
+        for (uint8_t i = 0; i < materialsAdded; i++) {
+            materials[i]->PrepareFrame(frame);
         }
     }
 
+    //layers left after culling, compiles first if a layer changed
+    uint8_t GetLayerCount() {
+        if (dirty) Compile();
+
+        return layerCount;
+    }
+
     RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override;
 };
 
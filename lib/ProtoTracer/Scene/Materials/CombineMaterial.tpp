@@ -1,152 +1,165 @@
 #pragma once
 
+//the curve based modes stay in float per channel, each layer saturates to 0 - 255 before it is blended in
 template<size_t materialCount>
-RGBColor CombineMaterial<materialCount>::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) {
-    Vector3D rgb;
-    Vector3D tempV;
-    RGBColor temp;
-
-    for (int i = 0; i < materialsAdded; i++) {
-        if (opacity[i] > 0.01f) {
-            switch (method[i]) {
-                case Base:
-                    temp = materials[i]->GetRGB(position, normal, uvw);
-
-                    rgb.X = temp.R;
-                    rgb.Y = temp.G;
-                    rgb.Z = temp.B;
-
-                    rgb = rgb * opacity[i];
-
-                    break;
-                case Add:
-                    // Add all colors to base color
-                    temp = materials[i]->GetRGB(position, normal, uvw);
+uint8_t CombineMaterial<materialCount>::BlendChannel(Method method, float base, float layer) {
+    float value;
+
+    switch (method) {
+        case Multiply:
+            value = base * layer;
+            break;
+        case Divide:
+            value = layer > 0.0f ? base / layer : (base > 0.0f ? 255.0f : 0.0f);
+            break;
+        case Screen:
+            // 1 - (1 - a)(1 - b)
+            value = 255.0f - (255.0f - base) * (255.0f - layer);
+            break;
+        case Overlay:
+            // if a < 0.5, 2ab
+            // else 1 - 2(1 - a)(1 - b)
+            if (base < 128) value = 2.0f * base * layer;
+            else value = 255.0f - 2.0f * (255.0f - base) * (255.0f - layer);
+            break;
+        case SoftLight:
+            // (1 - 2b)a^2 + 2ba
+            value = (255.0f - 2.0f * layer) * (base * base) + 2.0f * (layer * base);
+            break;
+        default:
+            value = base;
+            break;
+    }
 
-                    rgb.X = (rgb.X + temp.R) * opacity[i] + rgb.X * (1.0f - opacity[i]);
-                    rgb.Y = (rgb.Y + temp.G) * opacity[i] + rgb.Y * (1.0f - opacity[i]);
-                    rgb.Z = (rgb.Z + temp.B) * opacity[i] + rgb.Z * (1.0f - opacity[i]);
+    return uint8_t(Mathematics::Constrain(value, 0.0f, 255.0f));
+}
 
-                    break;
-                case Subtract:
-                    // Subtract from base color
-                    temp = materials[i]->GetRGB(position, normal, uvw);
+template<size_t materialCount>
+RGBColor CombineMaterial<materialCount>::BlendColors(Method method, const RGBColor& base, const RGBColor& layer) {
+    return RGBColor(BlendChannel(method, base.R, layer.R), BlendChannel(method, base.G, layer.G), BlendChannel(method, base.B, layer.B));
+}
 
-                    rgb.X = (rgb.X - temp.R) * opacity[i] + rgb.X * (1.0f - opacity[i]);
-                    rgb.Y = (rgb.Y - temp.G) * opacity[i] + rgb.Y * (1.0f - opacity[i]);
-                    rgb.Z = (rgb.Z - temp.B) * opacity[i] + rgb.Z * (1.0f - opacity[i]);
+//a base layer overwrites the color, so every layer under the last visible base is culled
+//replace keeps black transparent and efficient masks only fire on some pixels, neither can occlude ahead of time
+//until something lights the color it is known to be black, blends that keep black black are dropped there too
+template<size_t materialCount>
+void CombineMaterial<materialCount>::Compile() {
+    uint8_t start = 0;
 
-                    break;
-                case Multiply:
-                    // Multiply with base color
-                    temp = materials[i]->GetRGB(position, normal, uvw);
+    for (uint8_t i = 0; i < materialsAdded; i++) {
+        if (opacity[i] > 0.01f && method[i] == Base) start = i;
+    }
 
-                    rgb.X = (rgb.X * temp.R) * opacity[i] + rgb.X * (1.0f - opacity[i]);
-                    rgb.Y = (rgb.Y * temp.G) * opacity[i] + rgb.Y * (1.0f - opacity[i]);
-                    rgb.Z = (rgb.Z * temp.B) * opacity[i] + rgb.Z * (1.0f - opacity[i]);
+    bool black = true;
 
-                    break;
-                case Divide:
-                    // Divide from base color
-                    temp = materials[i]->GetRGB(position, normal, uvw);
+    layerCount = 0;
 
-                    rgb.X = (rgb.X / temp.R) * opacity[i] + rgb.X * (1.0f - opacity[i]);
-                    rgb.Y = (rgb.Y / temp.G) * opacity[i] + rgb.Y * (1.0f - opacity[i]);
-                    rgb.Z = (rgb.Z / temp.B) * opacity[i] + rgb.Z * (1.0f - opacity[i]);
+    for (uint8_t i = 0; i < materialsAdded; i++) {
+        if (opacity[i] <= 0.01f) continue;
 
-                    break;
-                case Darken:
-                    // Find minimum color in all cases
-                    temp = materials[i]->GetRGB(position, normal, uvw);
-                    tempV = Vector3D::Min(Vector3D(temp.R, temp.G, temp.B), rgb);
+        //bypass runs for its side effects and a firing mask overwrites the color and stops, neither depends on the layers before
+        if (method[i] == Bypass || method[i] == EfficientMask) {
+            layers[layerCount++] = i;
+            continue;
+        }
 
-                    rgb = Vector3D::LERP(rgb, tempV, opacity[i]);
+        if (i < start) continue;
+
+        switch (method[i]) {
+            case Subtract:
+            case Darken:
+            case Multiply:
+            case Divide:
+            case Overlay:
+            case SoftLight:
+                if (black) continue;
+                break;
+            default:
+                black = false;
+                break;
+        }
 
-                    break;
-                case Lighten:
-                    // Find maximum color in all cases
-                    temp = materials[i]->GetRGB(position, normal, uvw);
-                    tempV = Vector3D::Max(Vector3D(temp.R, temp.G, temp.B), rgb);
+        layers[layerCount++] = i;
+    }
 
-                    rgb = Vector3D::LERP(rgb, tempV, opacity[i]);
+    dirty = false;
+}
 
-                    break;
-                case Screen:
-                    // 1 - (1 - a)(1 - b)
-                    temp = materials[i]->GetRGB(position, normal, uvw);
+template<size_t materialCount>
+RGBColor CombineMaterial<materialCount>::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) {
+    RGBColor rgb;
+    RGBColor temp;
 
-                    tempV.X = 255.0f - (255.0f - rgb.X) * (255.0f - temp.R);
-                    tempV.Y = 255.0f - (255.0f - rgb.Y) * (255.0f - temp.G);
-                    tempV.Z = 255.0f - (255.0f - rgb.Z) * (255.0f - temp.B);
+    if (dirty) Compile();
 
-                    rgb = Vector3D::LERP(rgb, tempV, opacity[i]);
+    for (uint8_t l = 0; l < layerCount; l++) {
+        uint8_t i = layers[l];
 
-                    break;
-                case Overlay:
-                    // if a < 0.5, 2ab
-                    // else 1 - 2(1 - a)(1 - b)
-                    temp = materials[i]->GetRGB(position, normal, uvw);
+        switch (method[i]) {
+            case Base:
+                rgb = PixelKernels::Scale(materials[i]->GetRGB(position, normal, uvw), weight[i]);
 
-                    if (rgb.X < 128) tempV.X = 2.0f * rgb.X * temp.R;
-                    else tempV.X = 255.0f - 2.0f * (255.0f - rgb.X) * (255.0f - temp.R);
+                break;
+            case Add:
+                // Add all colors to base color
+                temp = materials[i]->GetRGB(position, normal, uvw);
+                rgb = PixelKernels::AddSaturate(rgb, PixelKernels::Scale(temp, weight[i]));
 
-                    if (rgb.Y < 128) tempV.Y = 2.0f * rgb.Y * temp.G;
-                    else tempV.Y = 255.0f - 2.0f * (255.0f - rgb.Y) * (255.0f - temp.G);
+                break;
+            case Subtract:
+                // Subtract from base color
+                temp = materials[i]->GetRGB(position, normal, uvw);
+                rgb = PixelKernels::SubtractSaturate(rgb, PixelKernels::Scale(temp, weight[i]));
 
-                    if (rgb.Z < 128) tempV.Z = 2.0f * rgb.Z * temp.B;
-                    else tempV.Z = 255.0f - 2.0f * (255.0f - rgb.Z) * (255.0f - temp.B);
+                break;
+            case Darken:
+                // Find minimum color in all cases
+                temp = materials[i]->GetRGB(position, normal, uvw);
+                rgb = PixelKernels::Lerp(rgb, PixelKernels::Min(temp, rgb), weight[i]);
 
-                    rgb = Vector3D::LERP(rgb, tempV, opacity[i]);
+                break;
+            case Lighten:
+                // Find maximum color in all cases
+                temp = materials[i]->GetRGB(position, normal, uvw);
+                rgb = PixelKernels::Lerp(rgb, PixelKernels::Max(temp, rgb), weight[i]);
 
-                    break;
-                case SoftLight:
-                    // (1 - 2b)a^2 + 2ba
-                    temp = materials[i]->GetRGB(position, normal, uvw);
+                break;
+            case Multiply:
+            case Divide:
+            case Screen:
+            case Overlay:
+            case SoftLight:
+                temp = materials[i]->GetRGB(position, normal, uvw);
+                rgb = PixelKernels::Lerp(rgb, BlendColors(method[i], rgb, temp), weight[i]);
 
-                    tempV.X = (255.0f - 2.0f * temp.R) * (rgb.X * rgb.X) + 2.0f * (temp.R * rgb.X);
-                    tempV.Y = (255.0f - 2.0f * temp.G) * (rgb.Y * rgb.Y) + 2.0f * (temp.G * rgb.Y);
-                    tempV.Z = (255.0f - 2.0f * temp.B) * (rgb.Z * rgb.Z) + 2.0f * (temp.B * rgb.Z);
+                break;
+            case Replace:
+                // black is transparent
+                temp = materials[i]->GetRGB(position, normal, uvw);
 
-                    rgb = Vector3D::LERP(rgb, tempV, opacity[i]);
+                if (temp.R > 0 || temp.G > 0 || temp.B > 0) rgb = PixelKernels::Lerp(rgb, temp, weight[i]);
 
-                    break;
-                case Replace:
-                    temp = materials[i]->GetRGB(position, normal, uvw);
+                break;
+            case EfficientMask:
+                temp = materials[i]->GetRGB(position, normal, uvw);
 
-                    if (temp.R > 0 || temp.G > 0 || temp.B > 0) {
-                        tempV.X = temp.R;
-                        tempV.Y = temp.G;
-                        tempV.Z = temp.B;
-                    }
+                if (temp.R > 128 && temp.G > 128 && temp.B > 128) {
+                    rgb = PixelKernels::Scale(temp, weight[i]);
 
-                    rgb = Vector3D::LERP(rgb, tempV, opacity[i]);
+                    l = layerCount;
 
                     break;
-                case EfficientMask:
-                    temp = materials[i]->GetRGB(position, normal, uvw);
-
-                    if (temp.R > 128 && temp.G > 128 && temp.B > 128) {
-                        rgb.X = temp.R;
-                        rgb.Y = temp.G;
-                        rgb.Z = temp.B;
-
-                        rgb = rgb * opacity[i];
-
-                        i = materialsAdded;
+                }
 
-                        break;
-                    }
+                break;
+            case Bypass:
+                materials[i]->GetRGB(position, normal, uvw);
+                break;
+            default:
 
-                    break;
-                case Bypass:
-                    materials[i]->GetRGB(position, normal, uvw);
-                    break;
-                default:
-
-                    break;
-            }
+                break;
         }
     }
 
-    return RGBColor(rgb.Constrain(0, 255));
+    return rgb;
 }
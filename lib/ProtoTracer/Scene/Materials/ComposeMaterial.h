@@ -0,0 +1,198 @@
+#pragma once
+
+#include <type_traits>
+#include "Material.h"
+#include "..\..\Utils\PixelKernels.h"
+
+//Layer stack with the blend order fixed at compile time, for stacks whose methods never change at runtime:
+//ComposeMaterial<BlendBase<GradientMaterial<4>>, BlendReplace<SimpleMaterial>> faceMaterial = ComposeMaterial<...>(&gradient, &simple);
+//each layer names the concrete material type, its GetRGB is called directly instead of through the vtable and the
+//blends unroll into one straight line of integer kernels, CombineMaterial remains for stacks configured at runtime
+//the curve based methods (Multiply, Divide, Screen, Overlay, SoftLight) are only available in CombineMaterial
+
+//opacity handling shared by the layers, below 0.01 a layer is skipped the same as in CombineMaterial
+//M must be the exact dynamic type of the material: the qualified call runs M::GetRGB even when the object is a
+//subclass of M that overrides it, so a subclass passed as its base silently renders as the base
+template<typename M>
+class BlendLayer {
+    static_assert(std::is_base_of<Material, M>::value, "layer type must be a material");
+
+public:
+    M* material;
+    uint16_t weight;
+
+    BlendLayer(M* material, float opacity) : material(material) {
+        SetOpacity(opacity);
+    }
+
+    void SetOpacity(float opacity){
+        weight = opacity > 0.01f ? PixelKernels::GetWeight(opacity) : 0;
+    }
+
+    void Prepare(FrameContext* frame){
+        material->PrepareFrame(frame);
+    }
+
+    RGBColor GetLayerRGB(const Vector3D& position, const Vector3D& normal, const Vector3D& uvw){
+        return material->M::GetRGB(position, normal, uvw);//qualified so the call is static and can be inlined
+    }
+};
+
+//each Blend returns false to end the stack early
+template<typename M>
+class BlendBase : public BlendLayer<M> {
+public:
+    BlendBase(M* material, float opacity = 1.0f) : BlendLayer<M>(material, opacity) {}
+
+    bool Blend(RGBColor& rgb, const Vector3D& position, const Vector3D& normal, const Vector3D& uvw){
+        if (this->weight > 0) rgb = PixelKernels::Scale(this->GetLayerRGB(position, normal, uvw), this->weight);
+
+        return true;
+    }
+};
+
+template<typename M>
+class BlendAdd : public BlendLayer<M> {
+public:
+    BlendAdd(M* material, float opacity = 1.0f) : BlendLayer<M>(material, opacity) {}
+
+    bool Blend(RGBColor& rgb, const Vector3D& position, const Vector3D& normal, const Vector3D& uvw){
+        if (this->weight > 0) rgb = PixelKernels::AddSaturate(rgb, PixelKernels::Scale(this->GetLayerRGB(position, normal, uvw), this->weight));
+
+        return true;
+    }
+};
+
+template<typename M>
+class BlendSubtract : public BlendLayer<M> {
+public:
+    BlendSubtract(M* material, float opacity = 1.0f) : BlendLayer<M>(material, opacity) {}
+
+    bool Blend(RGBColor& rgb, const Vector3D& position, const Vector3D& normal, const Vector3D& uvw){
+        if (this->weight > 0) rgb = PixelKernels::SubtractSaturate(rgb, PixelKernels::Scale(this->GetLayerRGB(position, normal, uvw), this->weight));
+
+        return true;
+    }
+};
+
+template<typename M>
+class BlendDarken : public BlendLayer<M> {
+public:
+    BlendDarken(M* material, float opacity = 1.0f) : BlendLayer<M>(material, opacity) {}
+
+    bool Blend(RGBColor& rgb, const Vector3D& position, const Vector3D& normal, const Vector3D& uvw){
+        if (this->weight > 0) rgb = PixelKernels::Lerp(rgb, PixelKernels::Min(this->GetLayerRGB(position, normal, uvw), rgb), this->weight);
+
+        return true;
+    }
+};
+
+template<typename M>
+class BlendLighten : public BlendLayer<M> {
+public:
+    BlendLighten(M* material, float opacity = 1.0f) : BlendLayer<M>(material, opacity) {}
+
+    bool Blend(RGBColor& rgb, const Vector3D& position, const Vector3D& normal, const Vector3D& uvw){
+        if (this->weight > 0) rgb = PixelKernels::Lerp(rgb, PixelKernels::Max(this->GetLayerRGB(position, normal, uvw), rgb), this->weight);
+
+        return true;
+    }
+};
+
+template<typename M>
+class BlendReplace : public BlendLayer<M> {
+public:
+    BlendReplace(M* material, float opacity = 1.0f) : BlendLayer<M>(material, opacity) {}
+
+    bool Blend(RGBColor& rgb, const Vector3D& position, const Vector3D& normal, const Vector3D& uvw){
+        if (this->weight == 0) return true;
+
+        RGBColor layer = this->GetLayerRGB(position, normal, uvw);
+
+        if (layer.R > 0 || layer.G > 0 || layer.B > 0) rgb = PixelKernels::Lerp(rgb, layer, this->weight);//black is transparent
+
+        return true;
+    }
+};
+
+template<typename M>
+class BlendMask : public BlendLayer<M> {//EfficientMask, a bright pixel takes over and ends the stack
+public:
+    BlendMask(M* material, float opacity = 1.0f) : BlendLayer<M>(material, opacity) {}
+
+    bool Blend(RGBColor& rgb, const Vector3D& position, const Vector3D& normal, const Vector3D& uvw){
+        if (this->weight == 0) return true;
+
+        RGBColor layer = this->GetLayerRGB(position, normal, uvw);
+
+        if (layer.R > 128 && layer.G > 128 && layer.B > 128){
+            rgb = PixelKernels::Scale(layer, this->weight);
+
+            return false;
+        }
+
+        return true;
+    }
+};
+
+//recursive layer list, each level holds one layer and blends it before handing the color to the rest
+template<typename... Layers>
+class ComposeLayers {
+protected:
+    ComposeLayers(){}
+
+    void BlendLayers(RGBColor&, const Vector3D&, const Vector3D&, const Vector3D&){}
+
+    void SetLayerOpacity(uint8_t, float){}
+
+    void PrepareLayers(FrameContext*){}
+};
+
+template<typename Layer, typename... Rest>
+class ComposeLayers<Layer, Rest...> : public ComposeLayers<Rest...> {
+private:
+    Layer layer;
+
+protected:
+    ComposeLayers(Layer layer, Rest... rest) : ComposeLayers<Rest...>(rest...), layer(layer) {}
+
+    void BlendLayers(RGBColor& rgb, const Vector3D& position, const Vector3D& normal, const Vector3D& uvw){
+        if (layer.Blend(rgb, position, normal, uvw)) ComposeLayers<Rest...>::BlendLayers(rgb, position, normal, uvw);
+    }
+
+    void SetLayerOpacity(uint8_t index, float opacity){
+        if (index == 0) layer.SetOpacity(opacity);
+        else ComposeLayers<Rest...>::SetLayerOpacity(index - 1, opacity);
+    }
+
+    void PrepareLayers(FrameContext* frame){
+        layer.Prepare(frame);
+
+        ComposeLayers<Rest...>::PrepareLayers(frame);
+    }
+};
+
+template<typename... Layers>
+class ComposeMaterial : public Material, private ComposeLayers<Layers...> {
+public:
+    static const uint8_t layerCount = sizeof...(Layers);
+
+    //takes the layers in order, a material pointer converts to its layer at full opacity
+    ComposeMaterial(Layers... layers) : ComposeLayers<Layers...>(layers...) {}
+
+    void SetOpacity(uint8_t index, float opacity){
+        this->SetLayerOpacity(index, opacity);
+    }
+
+    void Prepare(FrameContext* frame) override {
+        this->PrepareLayers(frame);
+    }
+
+    RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override {
+        RGBColor rgb;
+
+        this->BlendLayers(rgb, position, normal, uvw);
+
+        return rgb;
+    }
+};
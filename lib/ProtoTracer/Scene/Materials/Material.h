@@ -2,8 +2,14 @@
 
 #include "..\..\Utils\RGBColor.h"
 #include "..\..\Utils\Math\Vector3D.h"
+#include "..\..\Utils\Time\FrameContext.h"
 
 class Material{
+private:
+    uint32_t preparedFrame = 0;
+    uint32_t preparedMicros = 0;
+    bool prepared = false;
+
 public:
     enum Method{
         Base,
@@ -21,6 +27,23 @@ public:
         Bypass
     };
 
+    //per frame work that does not depend on the pixel, run before the first GetRGB of a frame so GetRGB only reads prepared state
+    //materials holding other materials forward with PrepareFrame, GetRGB has to stay correct if Prepare never ran
+    virtual void Prepare(FrameContext* frame){}
+
+    //runs Prepare once per frame however many objects, layers or cameras share the material, every call without a frame
+    void PrepareFrame(FrameContext* frame){
+        if (frame){
+            if (prepared && preparedFrame == frame->GetFrameCount() && preparedMicros == frame->GetMicros()) return;
+
+            prepared = true;
+            preparedFrame = frame->GetFrameCount();
+            preparedMicros = frame->GetMicros();
+        }
+
+        Prepare(frame);
+    }
+
     virtual RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) = 0;
   
 };
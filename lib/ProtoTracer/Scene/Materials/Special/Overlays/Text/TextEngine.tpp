@@ -108,7 +108,7 @@ RGBColor TextEngine<lineCount, characterWidth>::GetRGB(Vector3D position, Vector
     uint8_t charYBit = y % 10;
 
     char searchChar = lines[y / 10][x / 10];
-    bool blink = millis() % (blinkTime * 2) > blinkTime;
+    bool blink = FrameContext::GetCurrentMillis() % (blinkTime * 2) > blinkTime;
 
     if(charYBit == 0 || charYBit == 9 || charXBit == 0 || charXBit == 9){//margin
         if (searchChar > 90 && blink) {
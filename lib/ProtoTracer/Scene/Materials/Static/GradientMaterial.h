@@ -18,6 +18,22 @@ private:
     bool isStepped = false;
     float gradientShift = 0.0f;
 
+    //per pixel terms, refreshed by the setters
+    Vector2D rotationX = Vector2D(1.0f, 0.0f);//rotated unit axes
+    Vector2D rotationY = Vector2D(0.0f, 1.0f);
+    Vector2D shiftedOffset;
+    float inversePeriod = 1.0f;
+
+    //the ramp baked into 256 steps, rebuilt when the colors, hue or stepping change
+    RGBColor lut[256];
+    RGBColor hueBaseColors[colorCount];//base colors the current hue shift was applied to
+    float hueAngle = 0.0f;
+    bool hueCurrent = false;//stops hold the base colors shifted by hueAngle
+
+    void UpdateRotation();
+    void UpdateOffset();
+    void UpdateLUT();
+
 public:
     GradientMaterial(RGBColor* rgbColors, float gradientPeriod, bool isRadial, bool isStepped = false);
 
@@ -33,6 +49,8 @@ public:
 
     void GradientShift(float ratio);
 
+    void SetStepped(bool isStepped);
+
     void HueShift(float hueDeg);
 
     void UpdateRGB();
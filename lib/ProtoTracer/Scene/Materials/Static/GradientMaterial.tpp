@@ -9,6 +9,36 @@ GradientMaterial<colorCount>::GradientMaterial(RGBColor* rgbColors, float gradie
     this->baseRGBColors = rgbColors;
 
     UpdateGradient(rgbColors);
+    UpdateOffset();
+}
+
+template<size_t colorCount>
+void GradientMaterial<colorCount>::UpdateRotation() {
+    Quaternion rotation = Rotation(EulerAngles(Vector3D(0, 0, rotationAngle), EulerConstants::EulerOrderXYZS)).GetQuaternion();
+    Vector3D x = rotation.RotateVector(Vector3D(1.0f, 0.0f, 0.0f));
+    Vector3D y = rotation.RotateVector(Vector3D(0.0f, 1.0f, 0.0f));
+
+    rotationX = Vector2D(x.X, x.Y);
+    rotationY = Vector2D(y.X, y.Y);
+}
+
+template<size_t colorCount>
+void GradientMaterial<colorCount>::UpdateOffset() {
+    shiftedOffset = Vector2D(positionOffset.X - gradientShift * gradientPeriod, positionOffset.Y);
+    inversePeriod = gradientPeriod != 0.0f ? 1.0f / gradientPeriod : 0.0f;
+}
+
+// entry k covers ratios k / 256 to (k + 1) / 256 of the period, sampled at the start like the floor it replaces
+template<size_t colorCount>
+void GradientMaterial<colorCount>::UpdateLUT() {
+    for (uint16_t k = 0; k < 256; k++) {
+        float ratio = float(k) * float(colorCount) / 256.0f;
+        uint8_t startBox = floor(ratio);
+        uint8_t endBox = startBox + 1 >= (uint8_t)colorCount ? 0 : startBox + 1;
+
+        if (isStepped) lut[k] = rgbColors[startBox];
+        else lut[k] = RGBColor::InterpolateColors(rgbColors[startBox], rgbColors[endBox], ratio - float(startBox));
+    }
 }
 
 template<size_t colorCount>
@@ -16,11 +46,17 @@ void GradientMaterial<colorCount>::UpdateGradient(RGBColor* rgbColors) {
     for (uint8_t i = 0; i < colorCount; i++) {
         this->rgbColors[i] = rgbColors[i];
     }
+
+    hueCurrent = false;
+
+    UpdateLUT();
 }
 
 template<size_t colorCount>
 void GradientMaterial<colorCount>::SetPositionOffset(Vector2D positionOffset) {
     this->positionOffset = positionOffset;
+
+    UpdateOffset();
 }
 
 template<size_t colorCount>
@@ -30,24 +66,56 @@ void GradientMaterial<colorCount>::SetRotationOffset(Vector2D rotationOffset) {
 
 template<size_t colorCount>
 void GradientMaterial<colorCount>::SetRotationAngle(float rotationAngle) {
+    if (this->rotationAngle == rotationAngle) return;
+
     this->rotationAngle = rotationAngle;
+
+    UpdateRotation();
 }
 
 template<size_t colorCount>
 void GradientMaterial<colorCount>::SetGradientPeriod(float gradientPeriod) {
     this->gradientPeriod = gradientPeriod;
+
+    UpdateOffset();
 }
 
 template<size_t colorCount>
 void GradientMaterial<colorCount>::GradientShift(float ratio) {
     this->gradientShift = ratio;
+
+    UpdateOffset();
 }
 
+template<size_t colorCount>
+void GradientMaterial<colorCount>::SetStepped(bool isStepped) {
+    if (this->isStepped == isStepped) return;
+
+    this->isStepped = isStepped;
+
+    UpdateLUT();
+}
+
+// animated materials call this every frame, the stops and ramp are only rebuilt when the angle or the base colors moved
 template<size_t colorCount>
 void GradientMaterial<colorCount>::HueShift(float hueDeg) {
+    bool changed = !hueCurrent || hueDeg != hueAngle;
+
+    for (uint8_t i = 0; i < colorCount && !changed; i++) {
+        changed = baseRGBColors[i].R != hueBaseColors[i].R || baseRGBColors[i].G != hueBaseColors[i].G || baseRGBColors[i].B != hueBaseColors[i].B;
+    }
+
+    if (!changed) return;
+
+    hueAngle = hueDeg;
+    hueCurrent = true;
+
     for (uint8_t i = 0; i < colorCount; i++) {
+        hueBaseColors[i] = baseRGBColors[i];
         rgbColors[i] = baseRGBColors[i].HueShift(hueDeg);
     }
+
+    UpdateLUT();
 }
 
 template<size_t colorCount>
@@ -55,44 +123,33 @@ void GradientMaterial<colorCount>::UpdateRGB() {
     for (uint8_t i = 0; i < colorCount; i++) {
         rgbColors[i] = baseRGBColors[i];
     }
+
+    hueCurrent = false;
+
+    UpdateLUT();
 }
 
 template<size_t colorCount>
 RGBColor GradientMaterial<colorCount>::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) {
-    if (rotationAngle != 0) {
-        Quaternion temp = Rotation(EulerAngles(Vector3D(0, 0, rotationAngle), EulerConstants::EulerOrderXYZS)).GetQuaternion();
+    float x = position.X;
+    float y = position.Y;
 
-        position = temp.RotateVector(position);
+    if (rotationAngle != 0) {
+        x = position.X * rotationX.X + position.Y * rotationY.X;
+        y = position.X * rotationX.Y + position.Y * rotationY.Y;
     }
 
-    float pos = 0;
-    position = position - Vector3D(positionOffset.X, positionOffset.Y, 0);
-    position = position + Vector3D(gradientShift * gradientPeriod, 0, 0);
+    x -= shiftedOffset.X;
+    y -= shiftedOffset.Y;
 
-    if (isRadial) {
-        pos = sqrtf(position.X * position.X + position.Y * position.Y);
-        pos = fabs(fmodf(pos, gradientPeriod));
-    }
-    else {
-        // from x position, fit into bucket ratio
-        pos = fabs(fmodf(position.X, gradientPeriod));
-    }
-
-    // map from modulo'd x value to color count minimum
-    float ratio = Mathematics::Map(pos, 0.0f, gradientPeriod, 0.0f, float(colorCount));
-    uint8_t startBox = floor(ratio);
-    uint8_t endBox = startBox + 1 >= (uint8_t)colorCount ? 0 : startBox + 1;
+    float pos = isRadial ? sqrtf(x * x + y * y) : x;
 
-    RGBColor rgb;
+    // position in periods, mirrored about zero like fabs(fmodf()), the fraction of a period indexes the ramp
+    float periods = fabsf(pos * inversePeriod);
 
-    if (isStepped) {
-        rgb = rgbColors[startBox];
-    }
-    else {
-        float mu = Mathematics::Map(ratio, float(startBox), float(startBox + 1), 0.0f, 1.0f); // calculate mu between boxes
+    if (!(periods < 16777216.0f)) return lut[0];//no fraction left at this magnitude
 
-        rgb = RGBColor::InterpolateColors(rgbColors[startBox], rgbColors[endBox], mu);
-    }
+    float fraction = periods - float(uint32_t(periods));
 
-    return rgb;
+    return lut[uint8_t(fraction * 256.0f)];
 }
@@ -1,5 +1,5 @@
 #include "Image.h"
-#include "..\Math\Mathematics.h"
+#include "..\..\..\Utils\Math\Mathematics.h"
 
 Image::Image(const uint8_t* data, const uint8_t* rgbColors, unsigned int xPixels, unsigned int yPixels, uint8_t colors) {
     this->data = data;
@@ -7,43 +7,109 @@ Image::Image(const uint8_t* data, const uint8_t* rgbColors, unsigned int xPixels
     this->xPixels = xPixels;
     this->yPixels = yPixels;
     this->colors = colors;
+
+    texture.SetImage(data, xPixels, yPixels);
+    texture.SetPalette(rgbColors, colors);
+
+    UpdateTransform();
+}
+
+//same mapping as rotating about the offset and mapping the size onto the pixel count, flipped on both axes
+void Image::UpdateTransform() {
+    float cs = cosf(angle * Mathematics::MPID180);
+    float sn = sinf(angle * Mathematics::MPID180);
+    float xScale = size.X != 0.0f ? float(xPixels) / size.X : 0.0f;
+    float yScale = size.Y != 0.0f ? float(yPixels) / size.Y : 0.0f;
+
+    xA = -cs * xScale;
+    xB = sn * xScale;
+    yA = -sn * yScale;
+    yB = -cs * yScale;
+    xC = float(xPixels) / 2.0f - (xA * offset.X + xB * offset.Y);
+    yC = float(yPixels) / 2.0f - (yA * offset.X + yB * offset.Y);
+
+    if (pixelSpacing > 0.0f) {
+        //texels crossed when stepping one pixel along either axis of the panels
+        float texelsX = sqrtf(xA * xA + yA * yA) * pixelSpacing;
+        float texelsY = sqrtf(xB * xB + yB * yB) * pixelSpacing;
+
+        mipLevel = texture.SelectLevel(texelsX > texelsY ? texelsX : texelsY);
+    }
 }
 
 void Image::SetData(const uint8_t* data) {
     this->data = data;
+
+    texture.SetData(data);
 }
 
 void Image::SetColorPalette(const uint8_t* rgbColors) {
     this->rgbColors = rgbColors;
+
+    texture.SetPalette(rgbColors, colors);
 }
 
 void Image::SetSize(Vector2D size) {
     this->size = size;
+
+    UpdateTransform();
 }
 
 void Image::SetPosition(Vector2D offset) {
     this->offset = offset;
+
+    UpdateTransform();
 }
 
 void Image::SetRotation(float angle) {
     this->angle = angle;
+
+    UpdateTransform();
 }
 
 void Image::SetHueAngle(float hueAngle) {
     this->hueAngle = hueAngle;
+
+    texture.SetHueAngle(hueAngle);
 }
 
-RGBColor Image::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) {
-    Vector2D rPos = angle != 0.0f ? Vector2D(position.X, position.Y).Rotate(angle, offset) - offset : Vector2D(position.X, position.Y) - offset;
+void Image::SetFilter(Texture::Filter filter) {
+    texture.SetFilter(filter);
+}
+
+void Image::SetWrap(Texture::Wrap wrap) {
+    texture.SetWrap(wrap);
+}
 
-    unsigned int x = (unsigned int)Mathematics::Map(rPos.X, size.X / -2.0f, size.X / 2.0f, float(xPixels), 0.0f);
-    unsigned int y = (unsigned int)Mathematics::Map(rPos.Y, size.Y / -2.0f, size.Y / 2.0f, float(yPixels), 0.0f);
+void Image::SetPixelSpacing(float pixelSpacing) {
+    this->pixelSpacing = pixelSpacing;
 
-    if (x <= 1 || x >= xPixels || y <= 1 || y >= yPixels) return RGBColor();
+    UpdateTransform();
+}
 
-    unsigned int pos = data[x + y * xPixels] * 3;
+void Image::SetPixelSpacing(IPixelGroup* pixelGroup) {
+    Vector2D groupSize = pixelGroup->GetSize();
+    unsigned int count = pixelGroup->GetPixelCount();
 
-    if (pos > colors - (unsigned int)1) return RGBColor();
+    SetPixelSpacing(count > 0 ? sqrtf(fabsf(groupSize.X * groupSize.Y) / float(count)) : 0.0f);
+}
+
+void Image::SetMipLevel(uint8_t mipLevel) {
+    this->pixelSpacing = 0.0f;
+    this->mipLevel = mipLevel < texture.GetLevelCount() ? mipLevel : texture.GetLevelCount() - 1;
+}
+
+uint8_t Image::GetMipLevel() {
+    return mipLevel;
+}
+
+Texture* Image::GetTexture() {
+    return &texture;
+}
+
+RGBColor Image::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) {
+    float u = xA * position.X + xB * position.Y + xC;
+    float v = yA * position.X + yB * position.Y + yC;
 
-    return RGBColor(rgbColors[pos], rgbColors[pos + 1], rgbColors[pos + 2]).HueShift(hueAngle);
+    return texture.Sample(u, v, mipLevel);
 }
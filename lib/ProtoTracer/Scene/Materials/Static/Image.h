@@ -1,9 +1,22 @@
 #pragma once
 
 #include "..\Material.h"
-#include "..\..\..\..\..\Utils\Math\Vector2D.h"
+#include "..\..\..\Utils\Math\Vector2D.h"
+#include "..\..\..\Camera\Pixels\IPixelGroup.h"
+#include "Texture.h"
 
 class Image : public Material {
+private:
+    //position to pixel as one affine map, rebuilt by the setters
+    float xA = 0.0f, xB = 0.0f, xC = 0.0f;
+    float yA = 0.0f, yB = 0.0f, yC = 0.0f;
+
+    Texture texture;
+    float pixelSpacing = 0.0f;//world units between neighbouring pixels, 0 keeps the mip level fixed
+    uint8_t mipLevel = 0;
+
+    void UpdateTransform();
+
 public:
     Vector2D size;
     Vector2D offset;
@@ -31,5 +44,23 @@ public:
 
     void SetHueAngle(float hueAngle);
 
+    void SetFilter(Texture::Filter filter);
+
+    void SetWrap(Texture::Wrap wrap);
+
+    //selects the mip level from the size of a texel on the panels, use the pitch of the pixel group the image is drawn to
+    //opt in, until it is set the image samples level 0 and builds no mip levels
+    void SetPixelSpacing(float pixelSpacing);
+
+    //same from the average pitch of the group, its area shared out over its pixels
+    void SetPixelSpacing(IPixelGroup* pixelGroup);
+
+    //fixed mip level, for UV mapped models where the scale changes across the surface
+    void SetMipLevel(uint8_t mipLevel);
+
+    uint8_t GetMipLevel();
+
+    Texture* GetTexture();
+
     RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override;
 };
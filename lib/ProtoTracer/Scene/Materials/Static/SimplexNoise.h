@@ -17,9 +17,10 @@ private:
     const float G3 = 1.0f / 6.0f;
     float zPosition = 0.0f;
 
-    Vector3D grad3[12] = {Vector3D(1, 1, 0), Vector3D(-1, 1, 0), Vector3D(1, -1, 0), Vector3D(-1, -1, 0),  
-                          Vector3D(1, 0, 1), Vector3D(-1, 0, 1), Vector3D(1, 0, -1), Vector3D(-1, 0, -1), 
-                          Vector3D(0, 1, 1), Vector3D(0, -1, 1), Vector3D(0, 1, -1), Vector3D(0, -1, -1) };
+    //edge gradients as plain components, the dot products are written out instead of building vectors
+    const int8_t grad3[12][3] = {{1, 1, 0}, {-1, 1, 0}, {1, -1, 0}, {-1, -1, 0},
+                                 {1, 0, 1}, {-1, 0, 1}, {1, 0, -1}, {-1, 0, -1},
+                                 {0, 1, 1}, {0, -1, 1}, {0, 1, -1}, {0, -1, -1} };
 
     uint8_t p_supply[256] = {151,160,137,91,90,15, //this contains all the numbers between 0 and 255, these are put in a random order depending upon the seed
     131,13,201,95,96,53,194,233,7,225,140,36,103,30,69,142,8,99,37,240,21,10,23,
@@ -52,15 +53,41 @@ private:
     uint8_t perm[512];
     uint8_t permMod12[512];
 
+    //optional low resolution noise grid over a fixed area, rebuilt once per frame and bilinearly sampled per pixel
+    static const uint8_t maxGridSize = 64;
+
+    float* grid = nullptr;
+    uint16_t gridCapacity = 0;
+    uint8_t gridWidth = 0;
+    uint8_t gridHeight = 0;
+    Vector2D gridMinimum;
+    Vector2D gridMaximum;
+    Vector2D gridStep;//world units between grid samples
+    Vector2D gridInverseStep;
+    float quality = 1.0f;
+    bool gridDirty = true;
+
+    float Contribution(float t, uint8_t gradient, float x, float y, float z);
+    void BuildGrid();
+    float SampleGrid(float x, float y, bool* inside);
+
 public:
     SimplexNoise(int seed, GradientMaterial<colors>* gradientMaterial);
+    ~SimplexNoise();
 
     float Noise(float xin, float yin);
     float Noise(float xin, float yin, float zin);
 
+    //count samples along x starting at xin, stepX apart
+    void NoiseRow(float xin, float yin, float zin, float stepX, float* output, unsigned int count);
+
     void SetScale(Vector3D noiseScale);
     void SetZPosition(float zPosition);
 
+    //1 evaluates every pixel, below 1 positions inside the area read a grid of quality * 16 samples per noise unit
+    //(at most 64 by 64), positions outside the area still evaluate directly
+    void SetQuality(float quality, Vector2D minimum, Vector2D maximum);
+
     RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override;
 };
 
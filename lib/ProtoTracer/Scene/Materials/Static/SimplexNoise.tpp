@@ -20,6 +20,20 @@ SimplexNoise<colors>::SimplexNoise(int seed, GradientMaterial<colors>* gradientM
     }
 }
 
+template<size_t colors>
+SimplexNoise<colors>::~SimplexNoise() {
+    delete[] grid;
+}
+
+// Falloff times gradient dot product for one corner, a corner out of range clamps to a zero weight instead of branching
+template<size_t colors>
+float SimplexNoise<colors>::Contribution(float t, uint8_t gradient, float x, float y, float z) {
+    t = t > 0.0f ? t : 0.0f;
+    t *= t;
+
+    return t * t * ((grad3[gradient][0] * x) + (grad3[gradient][1] * y) + (grad3[gradient][2] * z));
+}
+
 // 2D simplex noise
 template<size_t colors>
 float SimplexNoise<colors>::Noise(float xin, float yin) {
@@ -57,24 +71,10 @@ float SimplexNoise<colors>::Noise(float xin, float yin) {
     int gi2 = permMod12[ii+1+perm[jj+1]];
     
     // Calculate the contribution from the three corners
-    float t0 = 0.5f - x0*x0-y0*y0;
-    if(t0 < 0) n0 = 0.0f;
-    else {
-        t0 *= t0;
-        n0 = t0 * t0 * grad3[gi0].DotProduct(Vector3D(x0, y0, 0));//dot(grad3[gi0], x0, y0);  // (x,y) of grad3 used for 2D gradient
-    }
-    float t1 = 0.5f - x1*x1-y1*y1;
-    if(t1 < 0) n1 = 0.0f;
-    else {
-        t1 *= t1;
-        n1 = t1 * t1 * grad3[gi1].DotProduct(Vector3D(x1, y1, 0));//dot(grad3[gi1], x1, y1);
-    }
-    float t2 = 0.5f - x2*x2-y2*y2;
-    if(t2 < 0) n2 = 0.0f;
-    else {
-        t2 *= t2;
-        n2 = t2 * t2 * grad3[gi2].DotProduct(Vector3D(x2, y2, 0));//dot(grad3[gi2], x2, y2);
-    }
+    n0 = Contribution(0.5f - x0*x0-y0*y0, gi0, x0, y0, 0.0f);
+    n1 = Contribution(0.5f - x1*x1-y1*y1, gi1, x1, y1, 0.0f);
+    n2 = Contribution(0.5f - x2*x2-y2*y2, gi2, x2, y2, 0.0f);
+
     // Add contributions from each corner to get the final noise value.
     // The result is scaled to return values in the interval [-1,1].
     return 70.0f * (n0 + n1 + n2);
@@ -100,19 +100,16 @@ float SimplexNoise<colors>::Noise(float xin, float yin, float zin) {
     
     // For the 3D case, the simplex shape is a slightly irregular tetrahedron.
     // Determine which simplex we are in.
-    int i1, j1, k1; // Offsets for second corner of simplex in (i,j,k) coords
-    int i2, j2, k2; // Offsets for third corner of simplex in (i,j,k) coords
-    
-    if(x0>=y0) {
-        if(y0>=z0) { i1=1; j1=0; k1=0; i2=1; j2=1; k2=0; } // X Y Z order
-        else if(x0>=z0) { i1=1; j1=0; k1=0; i2=1; j2=0; k2=1; } // X Z Y order
-        else { i1=0; j1=0; k1=1; i2=1; j2=0; k2=1; } // Z X Y order
-    }
-    else { // x0<y0
-        if(y0<z0) { i1=0; j1=0; k1=1; i2=0; j2=1; k2=1; } // Z Y X order
-        else if(x0<z0) { i1=0; j1=1; k1=0; i2=0; j2=1; k2=1; } // Y Z X order
-        else { i1=0; j1=1; k1=0; i2=1; j2=1; k2=0; } // Y X Z order
-    }
+    // The six orderings of x0, y0 and z0 reduce to three comparisons, same corners as the usual nested branches
+    int xy = x0 >= y0;
+    int yz = y0 >= z0;
+    int xz = x0 >= z0;
+    int i1 = xy & xz; // Offsets for second corner of simplex in (i,j,k) coords
+    int j1 = !xy & yz;
+    int k1 = !yz & !(xy & xz);
+    int i2 = xy | (yz & xz); // Offsets for third corner of simplex in (i,j,k) coords
+    int j2 = !xy | yz;
+    int k2 = !yz | (!xy & !xz);
     
     // A step of (1,0,0) in (i,j,k) means a step of (1-c,-c,-c) in (x,y,z),
     // a step of (0,1,0) in (i,j,k) means a step of (-c,1-c,-c) in (x,y,z), and
@@ -138,51 +135,170 @@ float SimplexNoise<colors>::Noise(float xin, float yin, float zin) {
     int gi3 = permMod12[ii+1+perm[jj+1+perm[kk+1]]];
     
     // Calculate the contribution from the four corners
-    float t0 = 0.6f - x0*x0 - y0*y0 - z0*z0;
-    if(t0 < 0) n0 = 0.0f;
-    else {
-        t0 *= t0;
-        n0 = t0 * t0 * grad3[gi0].DotProduct(Vector3D(x0, y0, z0));//dot(grad3[gi0], x0, y0, z0);
-    }
-    
-    float t1 = 0.6f - x1*x1 - y1*y1 - z1*z1;
-    if(t1 < 0) n1 = 0.0f;
-    else {
-        t1 *= t1;
-        n1 = t1 * t1 * grad3[gi1].DotProduct(Vector3D(x1, y1, z1));;//dot(grad3[gi1], x1, y1, z1);
-    }
-    
-    float t2 = 0.6f - x2*x2 - y2*y2 - z2*z2;
-    if(t2 < 0) n2 = 0.0f;
-    else {
-        t2 *= t2;
-        n2 = t2 * t2 * grad3[gi2].DotProduct(Vector3D(x2, y2, z2));//dot(grad3[gi2], x2, y2, z2);
-    }
-    
-    float t3 = 0.6f - x3*x3 - y3*y3 - z3*z3;
-    if(t3 < 0) n3 = 0.0f;
-    else {
-        t3 *= t3;
-        n3 = t3 * t3 * grad3[gi3].DotProduct(Vector3D(x3, y3, z3));//dot(grad3[gi3], x3, y3, z3);
-    }
-    
+    n0 = Contribution(0.6f - x0*x0 - y0*y0 - z0*z0, gi0, x0, y0, z0);
+    n1 = Contribution(0.6f - x1*x1 - y1*y1 - z1*z1, gi1, x1, y1, z1);
+    n2 = Contribution(0.6f - x2*x2 - y2*y2 - z2*z2, gi2, x2, y2, z2);
+    n3 = Contribution(0.6f - x3*x3 - y3*y3 - z3*z3, gi3, x3, y3, z3);
+
     // Add contributions from each corner to get the final noise value.
     // The result is scaled to stay just inside [-1,1]
     return 32.0f * (n0 + n1 + n2 + n3);
 }
 
+// 3D simplex noise along a row, same values as Noise() for each sample
+// neighbouring samples mostly share a skewed cell, so the cell origin and the hashed gradients of its eight cube corners
+// are only worked out when the cell changes, each sample is left with the floors, the corner ordering and the falloffs
+template<size_t colors>
+void SimplexNoise<colors>::NoiseRow(float xin, float yin, float zin, float stepX, float* output, unsigned int count) {
+    int cellI = 0, cellJ = 0, cellK = 0;
+    float X0 = 0.0f, Y0 = 0.0f, Z0 = 0.0f;
+    uint8_t corners[8];//gradient index of cube corner (di, dj, dk) at di * 4 + dj * 2 + dk
+    bool cached = false;
+
+    for (unsigned int n = 0; n < count; n++) {
+        float x = xin + stepX * n;
+
+        float s = (x+yin+zin)*F3;
+        int i = Mathematics::FFloor(x+s);
+        int j = Mathematics::FFloor(yin+s);
+        int k = Mathematics::FFloor(zin+s);
+
+        if (!cached || i != cellI || j != cellJ || k != cellK) {
+            cellI = i;
+            cellJ = j;
+            cellK = k;
+            cached = true;
+
+            float t = (i+j+k)*G3;
+            X0 = i-t;
+            Y0 = j-t;
+            Z0 = k-t;
+
+            int ii = i & 255;
+            int jj = j & 255;
+            int kk = k & 255;
+
+            for (uint8_t c = 0; c < 8; c++) {
+                uint8_t di = c >> 2;
+                uint8_t dj = (c >> 1) & 1;
+                uint8_t dk = c & 1;
+
+                corners[c] = permMod12[ii+di+perm[jj+dj+perm[kk+dk]]];
+            }
+        }
+
+        float x0 = x-X0;
+        float y0 = yin-Y0;
+        float z0 = zin-Z0;
+
+        int xy = x0 >= y0;
+        int yz = y0 >= z0;
+        int xz = x0 >= z0;
+        int i1 = xy & xz;
+        int j1 = !xy & yz;
+        int k1 = !yz & !(xy & xz);
+        int i2 = xy | (yz & xz);
+        int j2 = !xy | yz;
+        int k2 = !yz | (!xy & !xz);
+
+        float x1 = x0 - i1 + G3;
+        float y1 = y0 - j1 + G3;
+        float z1 = z0 - k1 + G3;
+        float x2 = x0 - i2 + 2.0f * G3;
+        float y2 = y0 - j2 + 2.0f * G3;
+        float z2 = z0 - k2 + 2.0f * G3;
+        float x3 = x0 - 1.0f + 3.0f * G3;
+        float y3 = y0 - 1.0f + 3.0f * G3;
+        float z3 = z0 - 1.0f + 3.0f * G3;
+
+        float n0 = Contribution(0.6f - x0*x0 - y0*y0 - z0*z0, corners[0], x0, y0, z0);
+        float n1 = Contribution(0.6f - x1*x1 - y1*y1 - z1*z1, corners[i1 * 4 + j1 * 2 + k1], x1, y1, z1);
+        float n2 = Contribution(0.6f - x2*x2 - y2*y2 - z2*z2, corners[i2 * 4 + j2 * 2 + k2], x2, y2, z2);
+        float n3 = Contribution(0.6f - x3*x3 - y3*y3 - z3*z3, corners[7], x3, y3, z3);
+
+        output[n] = 32.0f * (n0 + n1 + n2 + n3);
+    }
+}
+
 template<size_t colors>
 void SimplexNoise<colors>::SetScale(Vector3D noiseScale){
     this->noiseScale = noiseScale;
+    gridDirty = true;
 }
 
 template<size_t colors>
 void SimplexNoise<colors>::SetZPosition(float zPosition){
     this->zPosition = zPosition;
+    gridDirty = true;
+}
+
+template<size_t colors>
+void SimplexNoise<colors>::SetQuality(float quality, Vector2D minimum, Vector2D maximum){
+    this->quality = Mathematics::Constrain(quality, 0.0f, 1.0f);
+    this->gridMinimum = minimum;
+    this->gridMaximum = maximum;
+    gridDirty = true;
+}
+
+template<size_t colors>
+void SimplexNoise<colors>::BuildGrid() {
+    Vector2D size = gridMaximum - gridMinimum;
+    float density = 16.0f * quality;
+
+    gridWidth = Mathematics::Constrain(int(ceilf(fabsf(size.X * noiseScale.X) * density)) + 1, 2, int(maxGridSize));
+    gridHeight = Mathematics::Constrain(int(ceilf(fabsf(size.Y * noiseScale.Y) * density)) + 1, 2, int(maxGridSize));
+
+    if (gridCapacity < gridWidth * gridHeight) {
+        delete[] grid;
+
+        gridCapacity = gridWidth * gridHeight;
+        grid = new float[gridCapacity];
+    }
+
+    gridStep = Vector2D(size.X / float(gridWidth - 1), size.Y / float(gridHeight - 1));
+    gridInverseStep = Vector2D(gridStep.X != 0.0f ? 1.0f / gridStep.X : 0.0f, gridStep.Y != 0.0f ? 1.0f / gridStep.Y : 0.0f);
+
+    for (uint8_t j = 0; j < gridHeight; j++) {
+        float y = (gridMinimum.Y + gridStep.Y * j) * noiseScale.Y;
+
+        NoiseRow(gridMinimum.X * noiseScale.X, y, zPosition, gridStep.X * noiseScale.X, grid + j * gridWidth, gridWidth);
+    }
+
+    gridDirty = false;
+}
+
+template<size_t colors>
+float SimplexNoise<colors>::SampleGrid(float x, float y, bool* inside) {
+    float u = (x - gridMinimum.X) * gridInverseStep.X;
+    float v = (y - gridMinimum.Y) * gridInverseStep.Y;
+
+    *inside = u >= 0.0f && v >= 0.0f && u <= float(gridWidth - 1) && v <= float(gridHeight - 1);
+
+    if (!*inside) return 0.0f;
+
+    uint8_t i = u < float(gridWidth - 1) ? uint8_t(u) : gridWidth - 2;
+    uint8_t j = v < float(gridHeight - 1) ? uint8_t(v) : gridHeight - 2;
+    float fu = u - i;
+    float fv = v - j;
+
+    const float* row = grid + j * gridWidth + i;
+    float top = row[0] + (row[1] - row[0]) * fu;
+    float bottom = row[gridWidth] + (row[gridWidth + 1] - row[gridWidth]) * fu;
+
+    return top + (bottom - top) * fv;
 }
 
 template<size_t colors>
 RGBColor SimplexNoise<colors>::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) {
+    if (quality < 1.0f) {
+        if (gridDirty) BuildGrid();
+
+        bool inside;
+        float noise = SampleGrid(position.X, position.Y, &inside);
+
+        if (inside) return gradientMaterial->GetRGB(Vector3D(noise, 0, 0), Vector3D(), Vector3D());
+    }
+
     position = position * noiseScale;
 
     float noise = Noise(position.X, position.Y, zPosition);
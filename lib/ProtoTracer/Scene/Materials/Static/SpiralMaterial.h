@@ -14,7 +14,13 @@ private:
     Vector2D rotationOffset; // Point to rotate about
     float width;
     float bend;
-    float rotationAngle; // Rotate input xyPosition
+    float rotationAngle = 0.0f; // Rotate input xyPosition
+
+    // Per pixel terms, refreshed by the setters
+    Vector2D rotationX = Vector2D(1.0f, 0.0f); // Rotated unit axes
+    Vector2D rotationY = Vector2D(0.0f, 1.0f);
+    float angleScale; // width / pi
+    float hueAngle = 0.0f; // Shift applied to the current colors
 
 public:
     SpiralMaterial(uint8_t colorCount, RGBColor* rgbColors, float width, float bend);
@@ -4,6 +4,7 @@ SpiralMaterial::SpiralMaterial(uint8_t colorCount, RGBColor* rgbColors, float wi
     this->colorCount = colorCount;
     this->width = width;
     this->bend = bend;
+    this->angleScale = width / Mathematics::MPI;
 
     this->rgbColors = new RGBColor[colorCount];
     this->baseRGBColors = new RGBColor[colorCount];
@@ -28,11 +29,21 @@ void SpiralMaterial::SetRotationOffset(Vector2D rotationOffset) {
 }
 
 void SpiralMaterial::SetRotationAngle(float rotationAngle) {
+    if (this->rotationAngle == rotationAngle) return;
+
     this->rotationAngle = rotationAngle;
+
+    Quaternion rotation = Rotation(EulerAngles(Vector3D(0, 0, rotationAngle), EulerConstants::EulerOrderXYZS)).GetQuaternion();
+    Vector3D x = rotation.RotateVector(Vector3D(1.0f, 0.0f, 0.0f));
+    Vector3D y = rotation.RotateVector(Vector3D(0.0f, 1.0f, 0.0f));
+
+    rotationX = Vector2D(x.X, x.Y);
+    rotationY = Vector2D(y.X, y.Y);
 }
 
 void SpiralMaterial::SetWidth(float width) {
     this->width = width;
+    this->angleScale = width / Mathematics::MPI;
 }
 
 void SpiralMaterial::SetBend(float bend) {
@@ -40,29 +51,38 @@ void SpiralMaterial::SetBend(float bend) {
 }
 
 void SpiralMaterial::HueShift(float hueDeg) {
+    if (hueDeg == hueAngle) return; // The base colors are a private copy, only the angle can change them
+
+    hueAngle = hueDeg;
+
     for (int i = 0; i < colorCount; i++) {
         rgbColors[i] = baseRGBColors[i].HueShift(hueDeg);
     }
 }
 
 RGBColor SpiralMaterial::GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) {
-    if (rotationAngle != 0) {
-        Quaternion temp = Rotation(EulerAngles(Vector3D(0, 0, rotationAngle), EulerConstants::EulerOrderXYZS)).GetQuaternion();
+    float x = position.X;
+    float y = position.Y;
 
-        position = position - Vector3D(positionOffset.X, positionOffset.Y, 0);
+    if (rotationAngle != 0) {
+        float offsetX = x - positionOffset.X;
+        float offsetY = y - positionOffset.Y;
 
-        position = temp.RotateVector(position);
+        x = offsetX * rotationX.X + offsetY * rotationY.X;
+        y = offsetX * rotationX.Y + offsetY * rotationY.Y;
     }
 
     // From x position, fit into bucket ratio
     // Modulo x value into x range from start position to end position
 
-    float radius = Vector2D(position).Magnitude();
-    float angle = atan2(position.Y, position.X);
-    float ratio = Mathematics::Fract(width * angle / Mathematics::MPI + bend * powf(radius, 0.3f));
+    float radius = sqrtf(x * x + y * y);
+    float angle = atan2f(y, x);
+    float ratio = Mathematics::Fract(angleScale * angle + bend * powf(radius, 0.3f));
 
     int startBox = floor(ratio * colorCount);
 
+    if (startBox >= colorCount) startBox = colorCount - 1; // Fract of a tiny negative value rounds up to 1
+
     RGBColor rgb = rgbColors[startBox];
 
     return rgb;
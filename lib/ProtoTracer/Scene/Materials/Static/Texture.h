@@ -0,0 +1,327 @@
+#pragma once
+
+#include "..\..\..\Utils\PixelKernels.h"
+#include "..\..\..\Utils\Math\Mathematics.h"
+
+//Sampler for the palette images used by Image and UVMap, coordinates are in texels of the full size image
+//the palette goes through a hue shifted lookup table rebuilt only when the angle or palette changes, and smaller
+//mip levels are box filtered into RGB565 the first time they are sampled so only the levels in use take memory
+class Texture {
+public:
+    enum Wrap {
+        Border,//black outside of the image
+        Clamp,
+        Repeat,
+        Mirror
+    };
+
+    enum Filter {
+        Nearest,
+        Bilinear
+    };
+
+    static const uint8_t maxLevels = 8;
+
+private:
+    struct MipLevel {
+        uint16_t* texels = nullptr;
+        uint16_t width = 0;
+        uint16_t height = 0;
+        bool valid = false;
+    };
+
+    const uint8_t* data = nullptr;
+    const uint8_t* palette = nullptr;
+    uint16_t width = 0;
+    uint16_t height = 0;
+    uint16_t paletteSize = 0;//bytes, three per color, 0 reads all 256 colors
+
+    RGBColor lut[256];
+    float hueAngle = 0.0f;
+    bool lutDirty = true;
+
+    MipLevel levels[maxLevels];//level 0 is unused, the full size image is read through the palette
+    uint8_t levelCount = 1;
+
+    Wrap wrap = Border;
+    Filter filter = Nearest;
+
+    void UpdateLUT(){
+        //Image takes the palette size in 8 bits, so the full 768 byte palettes arrive as 0
+        uint16_t limit = paletteSize > 0 ? paletteSize : 256 * 3;
+
+        for (uint16_t i = 0; i < 256; i++){
+            uint16_t pos = i * 3;
+
+            if (!palette || pos + 2 >= limit) lut[i] = RGBColor();//indices past the palette stay black
+            else {
+                RGBColor rgb = RGBColor(palette[pos], palette[pos + 1], palette[pos + 2]);
+
+                lut[i] = hueAngle != 0.0f ? rgb.HueShift(hueAngle) : rgb;
+            }
+        }
+
+        lutDirty = false;
+    }
+
+    void UpdateLevelCount(){
+        levelCount = 1;
+
+        while (levelCount < maxLevels && ((width >> levelCount) > 0 || (height >> levelCount) > 0)) levelCount++;
+
+        Invalidate();
+    }
+
+    //box filters each level straight from the full size image, so building one level never needs the ones above it
+    void BuildLevel(uint8_t level){
+        MipLevel& mip = levels[level];
+        uint16_t levelWidth = width >> level > 0 ? width >> level : 1;
+        uint16_t levelHeight = height >> level > 0 ? height >> level : 1;
+
+        if (mip.width != levelWidth || mip.height != levelHeight){
+            delete[] mip.texels;
+
+            mip.texels = new uint16_t[levelWidth * levelHeight];
+            mip.width = levelWidth;
+            mip.height = levelHeight;
+        }
+
+        for (uint16_t y = 0; y < levelHeight; y++){
+            uint16_t y0 = y << level;
+            uint16_t y1 = (y + 1) << level < height ? (y + 1) << level : height;
+
+            for (uint16_t x = 0; x < levelWidth; x++){
+                uint16_t x0 = x << level;
+                uint16_t x1 = (x + 1) << level < width ? (x + 1) << level : width;
+                uint32_t r = 0, g = 0, b = 0, count = 0;
+
+                for (uint16_t sy = y0; sy < y1; sy++){
+                    const uint8_t* row = data + sy * width;
+
+                    for (uint16_t sx = x0; sx < x1; sx++){
+                        const RGBColor& rgb = lut[row[sx]];
+
+                        r += rgb.R;
+                        g += rgb.G;
+                        b += rgb.B;
+                    }
+                }
+
+                count = (x1 - x0) * (y1 - y0);
+
+                if (count > 0){
+                    r /= count;
+                    g /= count;
+                    b /= count;
+                }
+
+                mip.texels[x + y * levelWidth] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+            }
+        }
+
+        mip.valid = true;
+    }
+
+    static RGBColor Expand(uint16_t texel){
+        uint8_t r = (texel >> 11) & 0x1F;
+        uint8_t g = (texel >> 5) & 0x3F;
+        uint8_t b = texel & 0x1F;
+
+        return RGBColor((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+    }
+
+    //-1 for a coordinate outside of the image in border mode
+    int32_t WrapCoordinate(int32_t i, int32_t size){
+        switch (wrap){
+            case Clamp:
+                return i < 0 ? 0 : (i >= size ? size - 1 : i);
+            case Repeat:
+                i %= size;
+                return i < 0 ? i + size : i;
+            case Mirror:
+                i %= size * 2;
+                if (i < 0) i += size * 2;
+                return i < size ? i : size * 2 - 1 - i;
+            default:
+                return i >= 0 && i < size ? i : -1;
+        }
+    }
+
+    //coordinates already wrapped, -1 is outside of the image
+    RGBColor Fetch(uint8_t level, int32_t x, int32_t y, int32_t levelWidth){
+        if (x < 0 || y < 0) return RGBColor();
+
+        if (level == 0) return lut[data[x + y * levelWidth]];
+
+        return Expand(levels[level].texels[x + y * levelWidth]);
+    }
+
+public:
+    Texture(){}
+
+    ~Texture(){
+        for (uint8_t i = 0; i < maxLevels; i++){
+            delete[] levels[i].texels;
+        }
+    }
+
+    //copies the image and settings, the mip levels of the copy are built again when sampled
+    Texture(const Texture& texture){
+        *this = texture;
+    }
+
+    Texture& operator=(const Texture& texture){
+        if (this == &texture) return *this;
+
+        data = texture.data;
+        palette = texture.palette;
+        width = texture.width;
+        height = texture.height;
+        paletteSize = texture.paletteSize;
+        hueAngle = texture.hueAngle;
+        levelCount = texture.levelCount;
+        wrap = texture.wrap;
+        filter = texture.filter;
+        lutDirty = true;
+
+        Invalidate();
+
+        return *this;
+    }
+
+    void SetImage(const uint8_t* data, uint16_t width, uint16_t height){
+        this->data = data;
+
+        if (this->width != width || this->height != height){
+            this->width = width;
+            this->height = height;
+
+            UpdateLevelCount();
+        }
+        else Invalidate();
+    }
+
+    //also called for a new frame of an image sequence, the mip levels are rebuilt on their next sample
+    void SetData(const uint8_t* data){
+        if (this->data == data) return;
+
+        this->data = data;
+
+        Invalidate();
+    }
+
+    void SetPalette(const uint8_t* palette, uint16_t paletteSize){
+        if (this->palette == palette && this->paletteSize == paletteSize) return;
+
+        this->palette = palette;
+        this->paletteSize = paletteSize;
+
+        lutDirty = true;
+
+        Invalidate();
+    }
+
+    void SetHueAngle(float hueAngle){
+        if (this->hueAngle == hueAngle) return;
+
+        this->hueAngle = hueAngle;
+
+        lutDirty = true;
+
+        Invalidate();
+    }
+
+    void SetWrap(Wrap wrap){
+        this->wrap = wrap;
+    }
+
+    void SetFilter(Filter filter){
+        this->filter = filter;
+    }
+
+    Wrap GetWrap(){
+        return wrap;
+    }
+
+    Filter GetFilter(){
+        return filter;
+    }
+
+    uint8_t GetLevelCount(){
+        return levelCount;
+    }
+
+    //for palette or image contents changed in place
+    void Invalidate(){
+        for (uint8_t i = 0; i < maxLevels; i++){
+            levels[i].valid = false;
+        }
+    }
+
+    //level whose texels are closest to one per sample, from the number of full size texels between neighbouring samples
+    uint8_t SelectLevel(float texelsPerSample){
+        uint8_t level = 0;
+
+        while (level + 1 < levelCount && texelsPerSample >= 2.0f){
+            texelsPerSample *= 0.5f;
+            level++;
+        }
+
+        return level;
+    }
+
+    RGBColor Sample(float u, float v, uint8_t level = 0){
+        if (!data || width == 0 || height == 0) return RGBColor();
+
+        if (lutDirty) UpdateLUT();
+
+        if (level >= levelCount) level = levelCount - 1;
+        if (level > 0 && !levels[level].valid) BuildLevel(level);
+
+        int32_t levelWidth = level > 0 ? levels[level].width : width;
+        int32_t levelHeight = level > 0 ? levels[level].height : height;
+
+        if (level > 0){
+            float scale = 1.0f / float(1 << level);//power of two, exact
+
+            u *= scale;
+            v *= scale;
+        }
+
+        if (!(fabsf(u) < 1048576.0f && fabsf(v) < 1048576.0f)) return RGBColor();//keeps the integer conversions in range, also rejects NaN
+
+        if (filter == Nearest){
+            if (wrap == Border){//the default, only needs the range checks
+                if (u < 0.0f || v < 0.0f) return RGBColor();
+
+                int32_t x = int32_t(u);
+                int32_t y = int32_t(v);
+
+                if (x >= levelWidth || y >= levelHeight) return RGBColor();
+
+                return Fetch(level, x, y, levelWidth);
+            }
+
+            return Fetch(level, WrapCoordinate(int32_t(floorf(u)), levelWidth), WrapCoordinate(int32_t(floorf(v)), levelHeight), levelWidth);
+        }
+
+        //texel centers sit on the half coordinates
+        float fu = u - 0.5f;
+        float fv = v - 0.5f;
+        float x0 = floorf(fu);
+        float y0 = floorf(fv);
+        uint16_t weightX = uint16_t((fu - x0) * 256.0f);
+        uint16_t weightY = uint16_t((fv - y0) * 256.0f);
+        int32_t x = int32_t(x0);
+        int32_t y = int32_t(y0);
+        int32_t left = WrapCoordinate(x, levelWidth);
+        int32_t right = WrapCoordinate(x + 1, levelWidth);
+        int32_t up = WrapCoordinate(y, levelHeight);
+        int32_t down = WrapCoordinate(y + 1, levelHeight);
+
+        RGBColor top = PixelKernels::Lerp(Fetch(level, left, up, levelWidth), Fetch(level, right, up, levelWidth), weightX);
+        RGBColor bottom = PixelKernels::Lerp(Fetch(level, left, down, levelWidth), Fetch(level, right, down, levelWidth), weightX);
+
+        return PixelKernels::Lerp(top, bottom, weightY);
+    }
+};
@@ -27,6 +27,10 @@ public:
 
     void Update();
 
+    void Prepare(FrameContext* frame) override {
+        combineMaterial.PrepareFrame(frame);
+    }
+
     RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override;
 };
 
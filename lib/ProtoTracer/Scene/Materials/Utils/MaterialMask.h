@@ -17,5 +17,10 @@ public:
 
     float* GetOpacityReference();
 
+    void Prepare(FrameContext* frame) override {
+        materialShape->PrepareFrame(frame);
+        materialOuter->PrepareFrame(frame);
+    }
+
     RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override;
 };
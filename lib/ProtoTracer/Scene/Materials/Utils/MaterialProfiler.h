@@ -0,0 +1,270 @@
+#pragma once
+
+#include <Arduino.h>
+#include "..\Material.h"
+
+#if defined(ARM_DWT_CYCCNT)
+#define MATERIALPROFILER_CYCLES
+#elif !defined(ARDUINO)
+#include <chrono>
+#define MATERIALPROFILER_CHRONO
+#endif
+
+class ProfiledMaterial;
+
+//Per material GetRGB counts and time, wrap the layers of a stack to see which one dominates the frame:
+//ProfiledMaterial profiledNoise = ProfiledMaterial(&flowNoise, "FlowNoise"); then use &profiledNoise in its place
+//timing is compiled in with PROFILE_MATERIALS defined in the build flags, otherwise the wrapper only forwards and nothing is recorded
+//cycle counter on Teensy, std::chrono on desktop builds, micros() elsewhere
+//the engine closes each frame, self time excludes profiled materials nested inside, total time includes them
+class MaterialProfiler {
+public:
+    static const uint8_t maxMaterials = 16;
+
+    struct Stats {
+        uint32_t calls = 0;
+        uint32_t totalNanos = 0;
+        uint32_t selfNanos = 0;
+    };
+
+private:
+    static ProfiledMaterial** GetEntries(){
+        static ProfiledMaterial* entries[maxMaterials];
+
+        return entries;
+    }
+
+    static uint8_t& GetCount(){
+        static uint8_t count = 0;
+
+        return count;
+    }
+
+    static uint32_t& GetFrames(){
+        static uint32_t frames = 0;
+
+        return frames;
+    }
+
+    static void BeginTimer(){
+#if defined(MATERIALPROFILER_CYCLES)
+        ARM_DEMCR |= ARM_DEMCR_TRCENA;
+        ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+#endif
+    }
+
+public:
+    //ticks spent in nested profiled materials while the current one runs
+    static uint32_t& GetChildTicks(){
+        static uint32_t childTicks = 0;
+
+        return childTicks;
+    }
+
+    static uint32_t GetTicks(){
+#if defined(MATERIALPROFILER_CYCLES)
+        return ARM_DWT_CYCCNT;
+#elif defined(MATERIALPROFILER_CHRONO)
+        return uint32_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#else
+        return micros();
+#endif
+    }
+
+    static uint32_t TicksToNanoseconds(uint32_t ticks){
+#if defined(MATERIALPROFILER_CYCLES)
+#if defined(__IMXRT1062__)
+        return uint32_t(uint64_t(ticks) * 1000000000ull / F_CPU_ACTUAL);
+#else
+        return uint32_t(uint64_t(ticks) * 1000000000ull / F_CPU);
+#endif
+#elif defined(MATERIALPROFILER_CHRONO)
+        return ticks;
+#else
+        return ticks * 1000;
+#endif
+    }
+
+    static bool Register(ProfiledMaterial* material){
+        if (GetCount() >= maxMaterials) return false;
+
+        if (GetCount() == 0) BeginTimer();
+
+        GetEntries()[GetCount()++] = material;
+
+        return true;
+    }
+
+    static void Unregister(ProfiledMaterial* material){
+        ProfiledMaterial** entries = GetEntries();
+
+        for (uint8_t i = 0; i < GetCount(); i++){
+            if (entries[i] != material) continue;
+
+            for (uint8_t j = i + 1; j < GetCount(); j++) entries[j - 1] = entries[j];
+
+            GetCount()--;
+
+            return;
+        }
+    }
+
+    static uint8_t GetMaterialCount(){
+        return GetCount();
+    }
+
+    static ProfiledMaterial* GetMaterial(uint8_t index){
+        return index < GetCount() ? GetEntries()[index] : nullptr;
+    }
+
+    //frames closed since the last Reset
+    static uint32_t GetFrameCount(){
+        return GetFrames();
+    }
+
+    static void EndFrame();
+
+    static void Reset();
+
+    //one line per material: calls, total and self time of the last frame and the self time averaged since the last Reset
+    static void Print();
+};
+
+class ProfiledMaterial : public Material {
+private:
+    Material* material;
+    const char* name;
+
+    uint32_t calls = 0;
+    uint32_t totalTicks = 0;
+    uint32_t selfTicks = 0;
+
+    MaterialProfiler::Stats frame;
+    uint64_t accumulatedSelfNanos = 0;
+    uint64_t accumulatedCalls = 0;
+
+public:
+    ProfiledMaterial(Material* material, const char* name) : material(material), name(name) {
+        MaterialProfiler::Register(this);
+    }
+
+    ~ProfiledMaterial(){
+        MaterialProfiler::Unregister(this);
+    }
+
+    ProfiledMaterial(const ProfiledMaterial&) = delete;
+    ProfiledMaterial& operator=(const ProfiledMaterial&) = delete;
+
+    void SetMaterial(Material* material){
+        this->material = material;
+    }
+
+    Material* GetMaterial(){
+        return material;
+    }
+
+    const char* GetName(){
+        return name;
+    }
+
+    void Prepare(FrameContext* frame) override {
+        material->PrepareFrame(frame);
+    }
+
+    //counters of the last closed frame
+    const MaterialProfiler::Stats& GetFrameStats(){
+        return frame;
+    }
+
+    float GetAverageSelfNanos(){//per frame since the last Reset
+        uint32_t frames = MaterialProfiler::GetFrameCount();
+
+        return frames > 0 ? float(accumulatedSelfNanos) / float(frames) : 0.0f;
+    }
+
+    float GetAverageCallNanos(){
+        return accumulatedCalls > 0 ? float(accumulatedSelfNanos) / float(accumulatedCalls) : 0.0f;
+    }
+
+    void EndFrame(){
+        frame.calls = calls;
+        frame.totalNanos = MaterialProfiler::TicksToNanoseconds(totalTicks);
+        frame.selfNanos = MaterialProfiler::TicksToNanoseconds(selfTicks);
+
+        accumulatedSelfNanos += frame.selfNanos;
+        accumulatedCalls += calls;
+
+        calls = 0;
+        totalTicks = 0;
+        selfTicks = 0;
+    }
+
+    void Reset(){
+        frame = MaterialProfiler::Stats();
+        accumulatedSelfNanos = 0;
+        accumulatedCalls = 0;
+        calls = 0;
+        totalTicks = 0;
+        selfTicks = 0;
+    }
+
+    RGBColor GetRGB(Vector3D position, Vector3D normal, Vector3D uvw) override {
+#if defined(PROFILE_MATERIALS)
+        uint32_t& childTicks = MaterialProfiler::GetChildTicks();
+        uint32_t outerChildTicks = childTicks;
+
+        childTicks = 0;
+
+        uint32_t start = MaterialProfiler::GetTicks();
+        RGBColor rgb = material->GetRGB(position, normal, uvw);
+        uint32_t elapsed = MaterialProfiler::GetTicks() - start;
+
+        calls++;
+        totalTicks += elapsed;
+        selfTicks += elapsed - childTicks;
+
+        childTicks = outerChildTicks + elapsed;//the caller sees this call as nested time
+
+        return rgb;
+#else
+        return material->GetRGB(position, normal, uvw);
+#endif
+    }
+};
+
+inline void MaterialProfiler::EndFrame(){
+    for (uint8_t i = 0; i < GetCount(); i++) GetEntries()[i]->EndFrame();
+
+    GetFrames()++;
+}
+
+inline void MaterialProfiler::Reset(){
+    for (uint8_t i = 0; i < GetCount(); i++) GetEntries()[i]->Reset();
+
+    GetFrames() = 0;
+}
+
+inline void MaterialProfiler::Print(){
+#if defined(PROFILE_MATERIALS)
+    Serial.println("material\tcalls\ttotal us\tself us\tavg self us\tns/call");
+
+    for (uint8_t i = 0; i < GetCount(); i++){
+        ProfiledMaterial* material = GetEntries()[i];
+        const Stats& frame = material->GetFrameStats();
+
+        Serial.print(material->GetName());
+        Serial.print("\t");
+        Serial.print(frame.calls);
+        Serial.print("\t");
+        Serial.print(float(frame.totalNanos) / 1000.0f, 1);
+        Serial.print("\t");
+        Serial.print(float(frame.selfNanos) / 1000.0f, 1);
+        Serial.print("\t");
+        Serial.print(material->GetAverageSelfNanos() / 1000.0f, 1);
+        Serial.print("\t");
+        Serial.println(material->GetAverageCallNanos(), 1);
+    }
+#else
+    Serial.println("material profiling is off, define PROFILE_MATERIALS");
+#endif
+}
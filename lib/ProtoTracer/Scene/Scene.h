@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Screenspace\Effect.h"
+#include "Screenspace\EffectChain.h"
 #include "Objects\Object3D.h"
 
 class Scene {
@@ -8,7 +8,8 @@ private:
 	const int maxObjects;
 	Object3D** objects;
 	unsigned int numObjects = 0;
-    Effect* effect;
+    EffectChain effects;
+    FrameContext frame;
     bool doesUseEffect = false;
 
 	void RemoveElement(unsigned int element){
@@ -18,7 +19,7 @@ private:
 	}
 
 public:
-	Scene(unsigned int maxObjects) : maxObjects(maxObjects) {
+	Scene(unsigned int maxObjects, uint8_t maxEffects = 4) : maxObjects(maxObjects), effects(maxEffects) {
 		objects = new Object3D*[maxObjects];
 	}
 
@@ -39,11 +40,29 @@ public:
 	}
     
     Effect* GetEffect(){
-		return effect;
+		return &effects;
 	}
 
+	EffectChain* GetEffectChain(){
+		return &effects;
+	}
+
+	FrameContext* GetFrameContext(){
+		return &frame;
+	}
+
+	//replaces the chain with a single effect
 	void SetEffect(Effect* effect){
-		this->effect = effect;
+		effects.ClearEffects();
+		effects.AddEffect(effect);
+	}
+
+	void AddEffect(Effect* effect){
+		effects.AddEffect(effect);
+	}
+
+	void RemoveEffect(Effect* effect){
+		effects.RemoveEffect(effect);
 	}
 
 	void AddObject(Object3D* object){
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "TemporalEffect.h"
+
+//Bright pixels leave a fading trail, each pixel keeps the brighter of its new color and its decayed history
+class AfterimageTrail : public TemporalEffect {
+private:
+    float decay;
+
+protected:
+    void ApplyHistory(RGBColor* input, RGBColor* output, uint32_t* history, unsigned int pixelCount) override {
+        uint16_t scale = uint16_t(Mathematics::Constrain(decay * ratio, 0.0f, 1.0f) * 255.0f);
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            history[i] = Max(Pack(input[i]), Scale(history[i], scale));
+            output[i] = Unpack(history[i]);
+        }
+    }
+
+public:
+    AfterimageTrail(float decay = 0.85f) : decay(decay) {}
+
+    void SetDecay(float decay){//share of the trail kept each frame
+        this->decay = decay;
+    }
+};
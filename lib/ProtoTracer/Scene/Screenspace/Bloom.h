@@ -0,0 +1,288 @@
+#pragma once
+
+#include "Effect.h"
+
+//Glow around bright pixels, blurred on a coarse grid pyramid so the cost does not grow with the glow size
+class Bloom : public Effect {
+private:
+    static const uint8_t maxGroups = 4;
+    static const uint8_t maxLevels = 3;
+
+    struct Cell{
+        uint16_t R, G, B;
+    };
+
+    struct Sample{//bilinear position of a pixel on the finest grid, weights out of 256
+        uint8_t x, y, fx, fy;
+    };
+
+    struct BloomGrid{
+        IPixelGroup* pixelGroup = nullptr;
+        unsigned int pixelCount = 0;
+        Sample* samples = nullptr;
+        uint32_t* sums = nullptr;//red, green, blue and weight per finest cell while splatting
+        Cell* levels[maxLevels] = { nullptr, nullptr, nullptr };
+        uint8_t widths[maxLevels] = { 0, 0, 0 };
+        uint8_t heights[maxLevels] = { 0, 0, 0 };
+    };
+
+    BloomGrid grids[maxGroups];
+    uint8_t nextGrid = 0;
+    uint8_t threshold;
+    uint8_t levelCount;
+    float intensity;
+
+    static void Release(BloomGrid* grid){
+        delete[] grid->samples;
+        delete[] grid->sums;
+
+        grid->samples = nullptr;
+        grid->sums = nullptr;
+
+        for (uint8_t i = 0; i < maxLevels; i++){
+            delete[] grid->levels[i];
+
+            grid->levels[i] = nullptr;
+        }
+    }
+
+    //the finest level has cells of two pixel pitches, irregular layouts use the average pitch over their bounds
+    void Build(BloomGrid* grid){
+        IPixelGroup* pixelGroup = grid->pixelGroup;
+        unsigned int pixelCount = pixelGroup->GetPixelCount();
+        Vector2D size = pixelGroup->GetSize();
+        Vector2D minimum = pixelGroup->GetCenterCoordinate() - size / 2.0f;
+        float area = size.X * size.Y;
+        float pitch = area > Mathematics::EPSILON ? sqrtf(area / float(pixelCount)) : Mathematics::Max(size.X, size.Y) / float(pixelCount);
+        float cellSize = pitch > Mathematics::EPSILON ? pitch * 2.0f : 1.0f;
+
+        Release(grid);
+
+        grid->pixelCount = pixelCount;
+        grid->samples = new Sample[pixelCount];
+
+        for (uint8_t i = 0; i < maxLevels; i++){
+            uint8_t width = i == 0 ? uint8_t(Mathematics::Constrain(ceilf(size.X / cellSize), 1.0f, 255.0f)) : (grid->widths[i - 1] + 1) / 2;
+            uint8_t height = i == 0 ? uint8_t(Mathematics::Constrain(ceilf(size.Y / cellSize), 1.0f, 255.0f)) : (grid->heights[i - 1] + 1) / 2;
+
+            grid->widths[i] = width;
+            grid->heights[i] = height;
+            grid->levels[i] = new Cell[width * height];
+        }
+
+        grid->sums = new uint32_t[grid->widths[0] * grid->heights[0] * 4];
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            Vector2D location = pixelGroup->GetCoordinate(i);
+
+            SetSample(&grid->samples[i].x, &grid->samples[i].fx, (location.X - minimum.X) / cellSize - 0.5f, grid->widths[0]);
+            SetSample(&grid->samples[i].y, &grid->samples[i].fy, (location.Y - minimum.Y) / cellSize - 0.5f, grid->heights[0]);
+        }
+    }
+
+    static void SetSample(uint8_t* cell, uint8_t* weight, float position, uint8_t count){
+        if (position <= 0.0f){
+            *cell = 0;
+            *weight = 0;
+        }
+        else if (position >= float(count - 1)){
+            *cell = count - 1;
+            *weight = 0;
+        }
+        else{
+            *cell = uint8_t(position);
+            *weight = uint8_t(Mathematics::Min((position - float(*cell)) * 256.0f, 255.0f));
+        }
+    }
+
+    BloomGrid* GetGrid(IPixelGroup* pixelGroup){
+        for (uint8_t i = 0; i < maxGroups; i++){
+            if (grids[i].pixelGroup == pixelGroup){
+                if (grids[i].pixelCount != pixelGroup->GetPixelCount()) Build(&grids[i]);
+
+                return &grids[i];
+            }
+        }
+
+        BloomGrid* grid = &grids[nextGrid];
+
+        nextGrid = (nextGrid + 1) % maxGroups;
+
+        grid->pixelGroup = pixelGroup;
+
+        Build(grid);
+
+        return grid;
+    }
+
+    static void Splat(uint32_t* sum, const RGBColor& color, uint32_t weight){
+        sum[0] += color.R * weight;
+        sum[1] += color.G * weight;
+        sum[2] += color.B * weight;
+        sum[3] += weight;
+    }
+
+    //keeps what is above the threshold and splats it bilinearly into the finest cells, the inverse of the final lookup
+    void Threshold(BloomGrid* grid, RGBColor* input){
+        uint32_t* sums = grid->sums;
+        uint16_t width = grid->widths[0];
+        uint16_t cellCount = width * grid->heights[0];
+
+        for (uint16_t i = 0; i < cellCount * 4; i++){
+            sums[i] = 0;
+        }
+
+        for (unsigned int i = 0; i < grid->pixelCount; i++){
+            const Sample& sample = grid->samples[i];
+            uint32_t* sum = &sums[(sample.y * width + sample.x) * 4];
+            uint16_t right = sample.fx > 0 ? 4 : 0;
+            uint16_t up = sample.fy > 0 ? width * 4 : 0;
+            uint32_t fx = sample.fx, fy = sample.fy;
+            RGBColor bright = RGBColor(input[i].R > threshold ? input[i].R - threshold : 0, input[i].G > threshold ? input[i].G - threshold : 0, input[i].B > threshold ? input[i].B - threshold : 0);
+
+            Splat(sum, bright, (256 - fx) * (256 - fy) >> 8);
+            Splat(sum + right, bright, fx * (256 - fy) >> 8);
+            Splat(sum + up, bright, (256 - fx) * fy >> 8);
+            Splat(sum + up + right, bright, fx * fy >> 8);
+        }
+
+        Cell* cells = grid->levels[0];
+
+        for (uint16_t i = 0; i < cellCount; i++){
+            uint32_t* sum = &sums[i * 4];
+
+            if (sum[3] == 0) cells[i] = { 0, 0, 0 };
+            else cells[i] = { uint16_t(sum[0] / sum[3]), uint16_t(sum[1] / sum[3]), uint16_t(sum[2] / sum[3]) };
+        }
+    }
+
+    static void Downsample(Cell* input, uint8_t inputWidth, uint8_t inputHeight, Cell* output, uint8_t width, uint8_t height){
+        for (uint8_t y = 0; y < height; y++){
+            uint8_t y0 = y * 2;
+            uint8_t y1 = y0 + 1 < inputHeight ? y0 + 1 : y0;
+
+            for (uint8_t x = 0; x < width; x++){
+                uint8_t x0 = x * 2;
+                uint8_t x1 = x0 + 1 < inputWidth ? x0 + 1 : x0;
+                const Cell& a = input[y0 * inputWidth + x0];
+                const Cell& b = input[y0 * inputWidth + x1];
+                const Cell& c = input[y1 * inputWidth + x0];
+                const Cell& d = input[y1 * inputWidth + x1];
+
+                output[y * width + x] = { uint16_t((a.R + b.R + c.R + d.R) >> 2), uint16_t((a.G + b.G + c.G + d.G) >> 2), uint16_t((a.B + b.B + c.B + d.B) >> 2) };
+            }
+        }
+    }
+
+    //1 2 1 tent along rows then columns, stride steps between neighbors along the line
+    static void BlurLine(Cell* cells, uint8_t count, uint16_t stride){
+        Cell previous = cells[0];
+
+        for (uint8_t i = 0; i < count; i++){
+            Cell current = cells[i * stride];
+            const Cell& next = i + 1 < count ? cells[(i + 1) * stride] : current;
+
+            cells[i * stride] = { uint16_t((previous.R + current.R * 2 + next.R) >> 2), uint16_t((previous.G + current.G * 2 + next.G) >> 2), uint16_t((previous.B + current.B * 2 + next.B) >> 2) };
+
+            previous = current;
+        }
+    }
+
+    static void Blur(Cell* cells, uint8_t width, uint8_t height){
+        for (uint8_t y = 0; y < height; y++){
+            BlurLine(&cells[y * width], width, 1);
+        }
+
+        for (uint8_t x = 0; x < width; x++){
+            BlurLine(&cells[x], height, width);
+        }
+    }
+
+    //coarse cell centers sit a quarter cell away from the fine ones, so each fine cell takes 3/4 of the nearer coarse cell
+    static void UpsampleAdd(Cell* input, uint8_t inputWidth, uint8_t inputHeight, Cell* output, uint8_t width, uint8_t height){
+        for (uint8_t y = 0; y < height; y++){
+            uint8_t y0 = Mathematics::Min(y / 2, inputHeight - 1);
+            uint8_t y1 = y % 2 == 0 ? (y0 > 0 ? y0 - 1 : y0) : (y0 + 1 < inputHeight ? y0 + 1 : y0);
+
+            for (uint8_t x = 0; x < width; x++){
+                uint8_t x0 = Mathematics::Min(x / 2, inputWidth - 1);
+                uint8_t x1 = x % 2 == 0 ? (x0 > 0 ? x0 - 1 : x0) : (x0 + 1 < inputWidth ? x0 + 1 : x0);
+                const Cell& a = input[y0 * inputWidth + x0];
+                const Cell& b = input[y0 * inputWidth + x1];
+                const Cell& c = input[y1 * inputWidth + x0];
+                const Cell& d = input[y1 * inputWidth + x1];
+                Cell& cell = output[y * width + x];
+
+                cell.R += (a.R * 9 + b.R * 3 + c.R * 3 + d.R) >> 4;
+                cell.G += (a.G * 9 + b.G * 3 + c.G * 3 + d.G) >> 4;
+                cell.B += (a.B * 9 + b.B * 3 + c.B * 3 + d.B) >> 4;
+            }
+        }
+    }
+
+public:
+    Bloom(uint8_t threshold = 128, float intensity = 2.0f, uint8_t levelCount = 3) : threshold(threshold), intensity(intensity) {
+        this->levelCount = Mathematics::Constrain(levelCount, uint8_t(1), maxLevels);
+    }
+
+    ~Bloom(){
+        for (uint8_t i = 0; i < maxGroups; i++){
+            Release(&grids[i]);
+        }
+    }
+
+    void SetThreshold(uint8_t threshold){
+        this->threshold = threshold;
+    }
+
+    void SetIntensity(float intensity){
+        this->intensity = intensity;
+    }
+
+    void SetLevelCount(uint8_t levelCount){//more levels spread the glow further at almost no extra cost
+        this->levelCount = Mathematics::Constrain(levelCount, uint8_t(1), maxLevels);
+    }
+
+    void Apply(IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output) override {
+        BloomGrid* grid = GetGrid(pixelGroup);
+        uint8_t last = levelCount - 1;
+
+        Threshold(grid, input);
+
+        for (uint8_t i = 1; i <= last; i++){
+            Downsample(grid->levels[i - 1], grid->widths[i - 1], grid->heights[i - 1], grid->levels[i], grid->widths[i], grid->heights[i]);
+        }
+
+        Blur(grid->levels[last], grid->widths[last], grid->heights[last]);
+
+        for (uint8_t i = last; i > 0; i--){
+            UpsampleAdd(grid->levels[i], grid->widths[i], grid->heights[i], grid->levels[i - 1], grid->widths[i - 1], grid->heights[i - 1]);
+        }
+
+        //every level adds its own copy of the glow, so the gain is split between them
+        uint16_t gain = uint16_t(Mathematics::Constrain(intensity * ratio / float(levelCount), 0.0f, 255.0f) * 256.0f);
+        Cell* cells = grid->levels[0];
+        uint8_t width = grid->widths[0];
+
+        for (unsigned int i = 0; i < grid->pixelCount; i++){
+            const Sample& sample = grid->samples[i];
+            uint16_t index = sample.y * width + sample.x;
+            uint16_t right = sample.fx > 0 ? 1 : 0;
+            uint16_t up = sample.fy > 0 ? width : 0;
+            const Cell& a = cells[index];
+            const Cell& b = cells[index + right];
+            const Cell& c = cells[index + up];
+            const Cell& d = cells[index + up + right];
+            uint32_t fx = sample.fx, fy = sample.fy;
+            uint32_t wa = (256 - fx) * (256 - fy), wb = fx * (256 - fy), wc = (256 - fx) * fy, wd = fx * fy;
+
+            uint32_t red = ((a.R * wa + b.R * wb + c.R * wc + d.R * wd) >> 16) * gain >> 8;
+            uint32_t green = ((a.G * wa + b.G * wb + c.G * wc + d.G * wd) >> 16) * gain >> 8;
+            uint32_t blue = ((a.B * wa + b.B * wb + c.B * wc + d.B * wd) >> 16) * gain >> 8;
+
+            output[i].R = Mathematics::Min(input[i].R + red, uint32_t(255));
+            output[i].G = Mathematics::Min(input[i].G + green, uint32_t(255));
+            output[i].B = Mathematics::Min(input[i].B + blue, uint32_t(255));
+        }
+    }
+};
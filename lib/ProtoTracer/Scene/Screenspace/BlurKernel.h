@@ -0,0 +1,192 @@
+#pragma once
+
+#include "..\..\Camera\Pixels\IPixelGroup.h"
+#include "..\..\Utils\PixelKernels.h"
+
+//Sliding window averages along lines of pixels, the cost per pixel does not depend on the radius
+class BlurKernel {
+public:
+    enum Direction{
+        Horizontal,
+        Vertical
+    };
+
+    struct Cursor{
+        unsigned int index;
+        float error;//Bresenham error for angled lines
+    };
+
+private:
+    struct AxisWalker{
+        IPixelGroup* pixelGroup;
+        bool horizontal;
+
+        bool IsStart(unsigned int index){
+            unsigned int previous;
+            return horizontal ? !pixelGroup->GetLeftIndex(index, &previous) : !pixelGroup->GetDownIndex(index, &previous);
+        }
+
+        bool Next(Cursor* cursor){
+            return horizontal ? pixelGroup->GetRightIndex(cursor->index, &cursor->index) : pixelGroup->GetUpIndex(cursor->index, &cursor->index);
+        }
+    };
+
+    //steps along the major axis every time and along the minor axis when the error passes half a pixel
+    struct AngleWalker{
+        IPixelGroup* pixelGroup;
+        bool majorX;
+        bool minorPositive;
+        float slope;
+
+        //lines enter the layout through the edges behind the major and minor steps
+        bool IsStart(unsigned int index){
+            unsigned int previous;
+
+            if (!(majorX ? pixelGroup->GetLeftIndex(index, &previous) : pixelGroup->GetDownIndex(index, &previous))) return true;
+
+            if (majorX) return minorPositive ? !pixelGroup->GetDownIndex(index, &previous) : !pixelGroup->GetUpIndex(index, &previous);
+            else return minorPositive ? !pixelGroup->GetLeftIndex(index, &previous) : !pixelGroup->GetRightIndex(index, &previous);
+        }
+
+        bool Next(Cursor* cursor){
+            unsigned int next;
+
+            if (!(majorX ? pixelGroup->GetRightIndex(cursor->index, &next) : pixelGroup->GetUpIndex(cursor->index, &next))) return false;
+
+            cursor->error += slope;
+
+            if (cursor->error >= 0.5f){
+                cursor->error -= 1.0f;
+
+                bool valid;
+
+                if (majorX) valid = minorPositive ? pixelGroup->GetUpIndex(next, &next) : pixelGroup->GetDownIndex(next, &next);
+                else valid = minorPositive ? pixelGroup->GetRightIndex(next, &next) : pixelGroup->GetLeftIndex(next, &next);
+
+                if (!valid) return false;
+            }
+
+            cursor->index = next;
+
+            return true;
+        }
+    };
+
+    static void Add(uint32_t* sum, const RGBColor& color){
+        sum[0] += color.R;
+        sum[1] += color.G;
+        sum[2] += color.B;
+    }
+
+    static void Subtract(uint32_t* sum, const RGBColor& color){
+        sum[0] -= color.R;
+        sum[1] -= color.G;
+        sum[2] -= color.B;
+    }
+
+    //averages a window of radius pixels on both sides, the window shrinks at the line ends instead of darkening them
+    template<typename Walker>
+    static void BlurLine(Walker* walker, RGBColor* input, RGBColor* output, unsigned int start, uint16_t radius, uint8_t* visited){
+        Cursor current = { start, 0.0f };
+        Cursor head = current;
+        Cursor tail = current;
+        uint32_t sum[3] = { 0, 0, 0 };
+        uint16_t count = 1;
+        uint16_t behind = 0;
+
+        Add(sum, input[start]);
+
+        for (uint16_t i = 0; i < radius; i++){
+            if (!walker->Next(&head)) break;
+
+            Add(sum, input[head.index]);
+            count++;
+        }
+
+        while (true){
+            output[current.index].R = sum[0] / count;
+            output[current.index].G = sum[1] / count;
+            output[current.index].B = sum[2] / count;
+
+            if (visited) visited[current.index] = 1;
+
+            if (!walker->Next(&current)) break;
+
+            Cursor next = head;
+
+            if (walker->Next(&next)){
+                head = next;
+                Add(sum, input[head.index]);
+                count++;
+            }
+
+            if (behind == radius){
+                Subtract(sum, input[tail.index]);
+                walker->Next(&tail);
+                count--;
+            }
+            else{
+                behind++;
+            }
+        }
+    }
+
+public:
+    //box blur along rows or columns, pixels on closed loops without a line start keep their input color
+    static void Box(IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output, Direction direction, uint16_t radius){
+        unsigned int pixelCount = pixelGroup->GetPixelCount();
+        AxisWalker walker = { pixelGroup, direction == Horizontal };
+
+        PixelKernels::Copy(input, output, pixelCount);
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            if (walker.IsStart(i)) BlurLine(&walker, input, output, i, radius, nullptr);
+        }
+    }
+
+    static uint16_t GetGaussianRadius(uint16_t boxRadius){//three passes of this radius spread about as far as one box of boxRadius
+        uint16_t radius = uint16_t(float(boxRadius) * 0.58f + 0.5f);
+
+        return radius > 0 ? radius : 1;
+    }
+
+    //three box passes approximate a gaussian with a variance of radius * (radius + 1), input is used as scratch and the result ends in output
+    static void Gaussian(IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output, Direction direction, uint16_t radius){
+        Box(pixelGroup, input, output, direction, radius);
+        Box(pixelGroup, output, input, direction, radius);
+        Box(pixelGroup, input, output, direction, radius);
+    }
+
+    //box blur along lines at an angle in degrees, visited must hold one byte per pixel
+    static void Angled(IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output, float angle, uint16_t radius, uint8_t* visited){
+        unsigned int pixelCount = pixelGroup->GetPixelCount();
+        float dx = cosf(angle * Mathematics::MPID180);
+        float dy = sinf(angle * Mathematics::MPID180);
+        AngleWalker walker;
+
+        walker.pixelGroup = pixelGroup;
+        walker.majorX = fabsf(dx) >= fabsf(dy);
+
+        //the blur is symmetric, so flip the direction until the major step is right or up
+        if ((walker.majorX && dx < 0.0f) || (!walker.majorX && dy < 0.0f)){
+            dx = -dx;
+            dy = -dy;
+        }
+
+        walker.minorPositive = walker.majorX ? dy > 0.0f : dx > 0.0f;
+        walker.slope = walker.majorX ? fabsf(dy / dx) : fabsf(dx / dy);
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            visited[i] = 0;
+        }
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            if (walker.IsStart(i)) BlurLine(&walker, input, output, i, radius, visited);
+        }
+
+        //pixels stepped over by the minor axis start their own line
+        for (unsigned int i = 0; i < pixelCount; i++){
+            if (!visited[i]) BlurLine(&walker, input, output, i, radius, visited);
+        }
+    }
+};
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Effect.h"
+
+//Per pixel color mapping, runs in place and is fused with neighboring color effects in an EffectChain
+class ColorEffect : public Effect {
+public:
+    ColorEffect(){}
+
+    void Apply(IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output) override {
+        for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
+            output[i] = ApplyPixel(input[i]);
+        }
+    }
+
+    void ApplyEffect(IPixelGroup* pixelGroup) override {
+        Apply(pixelGroup, pixelGroup->GetColors(), pixelGroup->GetColors());
+    }
+
+    bool IsColorOnly() override {
+        return true;
+    }
+
+    virtual RGBColor ApplyPixel(const RGBColor& color) override = 0;
+
+};
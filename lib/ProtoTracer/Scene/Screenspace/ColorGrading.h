@@ -0,0 +1,175 @@
+#pragma once
+
+#include "ColorEffect.h"
+
+//Hue, saturation, contrast, brightness and palette remaps baked into one 16x16x16 lookup table with trilinear interpolation
+//the table is only rebuilt when a parameter changes, so grading costs the same per pixel however many adjustments are stacked
+//the hue stage is the same formula as RGBColor::HueShift, so a shift here matches shifting the colors themselves
+class ColorGrading : public ColorEffect {
+private:
+    static const uint8_t gridSize = 16;
+    static const uint8_t gridStep = 17;//255 / (gridSize - 1), nodes land exactly on 0 and 255
+
+    RGBColor* lut = nullptr;
+    bool dirty = true;
+
+    float hueShift = 0.0f;
+    float saturation = 1.0f;
+    float contrast = 1.0f;
+    float brightness = 1.0f;
+
+    const RGBColor* palette = nullptr;
+    uint8_t paletteCount = 0;
+    float paletteMix = 1.0f;
+
+    bool UpdateParameter(float* parameter, float value){
+        if (*parameter == value) return false;
+
+        *parameter = value;
+        dirty = true;
+
+        return true;
+    }
+
+    void Rebuild(){
+        if (!lut) lut = new RGBColor[gridSize * gridSize * gridSize];
+
+        //same half angle mix and clamp as RGBColor::HueShift
+        float angle = (hueShift < 0.0f ? hueShift + 360.0f : hueShift) * Mathematics::MPI / 180.0f;
+        float halfHueSin = sinf(angle / 2.0f);
+        float halfHueCos = cosf(angle / 2.0f);
+
+        for (uint8_t r = 0; r < gridSize; r++){
+            for (uint8_t g = 0; g < gridSize; g++){
+                for (uint8_t b = 0; b < gridSize; b++){
+                    float x = float(r * gridStep);
+                    float y = float(g * gridStep);
+                    float z = float(b * gridStep);
+
+                    float red = Mathematics::Constrain(x * halfHueCos - y * halfHueSin, 0.0f, 255.0f);
+                    float green = Mathematics::Constrain(x * halfHueSin + y * halfHueCos, 0.0f, 255.0f);
+                    float blue = Mathematics::Constrain(z * halfHueCos - y * halfHueSin, 0.0f, 255.0f);
+
+                    float luma = red * 0.299f + green * 0.587f + blue * 0.114f;
+
+                    red = ((luma + (red - luma) * saturation) - 128.0f) * contrast + 128.0f;
+                    green = ((luma + (green - luma) * saturation) - 128.0f) * contrast + 128.0f;
+                    blue = ((luma + (blue - luma) * saturation) - 128.0f) * contrast + 128.0f;
+
+                    RGBColor graded = RGBColor(
+                        uint8_t(Mathematics::Constrain(red * brightness, 0.0f, 255.0f) + 0.5f),
+                        uint8_t(Mathematics::Constrain(green * brightness, 0.0f, 255.0f) + 0.5f),
+                        uint8_t(Mathematics::Constrain(blue * brightness, 0.0f, 255.0f) + 0.5f)
+                    );
+
+                    lut[(r * gridSize + g) * gridSize + b] = Remap(graded);
+                }
+            }
+        }
+
+        dirty = false;
+    }
+
+    static int32_t Lerp(int32_t a, int32_t b, int32_t fraction){//fraction out of gridStep
+        return a * (gridStep - fraction) + b * fraction;
+    }
+
+protected:
+    //last step of every table entry, maps the graded color through the palette by luminance
+    //override for other remaps and call Invalidate when their inputs change
+    virtual RGBColor Remap(const RGBColor& color){
+        if (!palette || paletteCount == 0) return color;
+
+        uint16_t luma = (color.R * 77 + color.G * 150 + color.B * 29) >> 8;
+
+        RGBColor mapped;
+
+        if (paletteCount == 1) mapped = palette[0];
+        else {
+            uint16_t position = luma * (paletteCount - 1);
+            uint8_t index = position / 255;
+            uint8_t fraction = position % 255;
+
+            if (index >= paletteCount - 1) mapped = palette[paletteCount - 1];
+            else mapped = PixelKernels::Lerp(palette[index], palette[index + 1], fraction * 256 / 255);
+        }
+
+        return PixelKernels::Lerp(color, mapped, PixelKernels::GetWeight(paletteMix));
+    }
+
+public:
+    ColorGrading(){}
+
+    ~ColorGrading(){
+        delete[] lut;
+    }
+
+    void SetHueShift(float hueDeg){
+        UpdateParameter(&hueShift, fmodf(hueDeg, 360.0f));
+    }
+
+    void SetSaturation(float saturation){//0 is grey, 1 unchanged
+        UpdateParameter(&this->saturation, saturation);
+    }
+
+    void SetContrast(float contrast){//around mid grey, 1 unchanged
+        UpdateParameter(&this->contrast, contrast);
+    }
+
+    void SetBrightness(float brightness){//multiplier, 1 unchanged
+        UpdateParameter(&this->brightness, brightness);
+    }
+
+    //remaps luminance onto the palette, mix blends between the graded and the remapped color
+    void SetPalette(const RGBColor* palette, uint8_t paletteCount, float paletteMix = 1.0f){
+        this->palette = palette;
+        this->paletteCount = paletteCount;
+        this->paletteMix = paletteMix;
+
+        dirty = true;
+    }
+
+    void ClearPalette(){
+        SetPalette(nullptr, 0);
+    }
+
+    //rebuilds on the next pixel, for palette contents or subclass remaps that changed in place
+    void Invalidate(){
+        dirty = true;
+    }
+
+    RGBColor ApplyPixel(const RGBColor& color) override {
+        if (dirty) Rebuild();
+
+        uint8_t r = color.R / gridStep;
+        uint8_t g = color.G / gridStep;
+        uint8_t b = color.B / gridStep;
+        uint8_t fr = color.R - r * gridStep;
+        uint8_t fg = color.G - g * gridStep;
+        uint8_t fb = color.B - b * gridStep;
+        uint8_t r1 = r < gridSize - 1 ? r + 1 : r;//255 lands on the last node with no fraction
+        uint8_t g1 = g < gridSize - 1 ? g + 1 : g;
+        uint8_t b1 = b < gridSize - 1 ? b + 1 : b;
+
+        const RGBColor& c000 = lut[(r * gridSize + g) * gridSize + b];
+        const RGBColor& c001 = lut[(r * gridSize + g) * gridSize + b1];
+        const RGBColor& c010 = lut[(r * gridSize + g1) * gridSize + b];
+        const RGBColor& c011 = lut[(r * gridSize + g1) * gridSize + b1];
+        const RGBColor& c100 = lut[(r1 * gridSize + g) * gridSize + b];
+        const RGBColor& c101 = lut[(r1 * gridSize + g) * gridSize + b1];
+        const RGBColor& c110 = lut[(r1 * gridSize + g1) * gridSize + b];
+        const RGBColor& c111 = lut[(r1 * gridSize + g1) * gridSize + b1];
+
+        const int32_t denominator = gridStep * gridStep * gridStep;
+
+        int32_t red = Lerp(Lerp(Lerp(c000.R, c001.R, fb), Lerp(c010.R, c011.R, fb), fg), Lerp(Lerp(c100.R, c101.R, fb), Lerp(c110.R, c111.R, fb), fg), fr);
+        int32_t green = Lerp(Lerp(Lerp(c000.G, c001.G, fb), Lerp(c010.G, c011.G, fb), fg), Lerp(Lerp(c100.G, c101.G, fb), Lerp(c110.G, c111.G, fb), fg), fr);
+        int32_t blue = Lerp(Lerp(Lerp(c000.B, c001.B, fb), Lerp(c010.B, c011.B, fb), fg), Lerp(Lerp(c100.B, c101.B, fb), Lerp(c110.B, c111.B, fb), fg), fr);
+
+        RGBColor graded = RGBColor((red + denominator / 2) / denominator, (green + denominator / 2) / denominator, (blue + denominator / 2) / denominator);
+
+        if (ratio >= 1.0f) return graded;
+
+        return PixelKernels::Lerp(color, graded, PixelKernels::GetWeight(ratio));
+    }
+};
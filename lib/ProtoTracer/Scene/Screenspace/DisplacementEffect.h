@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Effect.h"
+
+//Warps that move whole pixels, the source index of every pixel is cached and only rebuilt when a parameter changes
+//pixel positions relative to the group center are cached with the map, so a rebuild does not go through the layout again
+class DisplacementEffect : public Effect {
+private:
+    static const uint8_t maxGroups = 4;
+    static const uint16_t NoPixel = 0xFFFF;
+
+    struct DisplacementMap{
+        IPixelGroup* pixelGroup = nullptr;
+        uint16_t* sources = nullptr;
+        Vector2D* positions = nullptr;
+        unsigned int pixelCount = 0;
+        uint32_t version = 0;
+    };
+
+    DisplacementMap maps[maxGroups];
+    uint8_t nextMap = 0;
+    uint32_t version = 1;
+
+    DisplacementMap* GetMap(IPixelGroup* pixelGroup){
+        for (uint8_t i = 0; i < maxGroups; i++){
+            if (maps[i].pixelGroup == pixelGroup) return &maps[i];
+        }
+
+        //more groups than slots, reuse the oldest
+        DisplacementMap* map = &maps[nextMap];
+
+        nextMap = (nextMap + 1) % maxGroups;
+
+        map->pixelGroup = pixelGroup;
+        map->pixelCount = 0;//positions belong to the previous group
+        map->version = 0;
+
+        return map;
+    }
+
+    void BuildMap(DisplacementMap* map){
+        unsigned int pixelCount = map->pixelGroup->GetPixelCount();
+
+        if (map->pixelCount != pixelCount){
+            delete[] map->sources;
+            delete[] map->positions;
+
+            map->sources = new uint16_t[pixelCount];
+            map->positions = new Vector2D[pixelCount];
+            map->pixelCount = pixelCount;
+
+            Vector2D center = map->pixelGroup->GetCenterCoordinate();
+
+            for (unsigned int i = 0; i < pixelCount; i++){
+                map->positions[i] = map->pixelGroup->GetCoordinate(i) - center;
+            }
+        }
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            unsigned int sourceIndex;
+
+            map->sources[i] = GetSourceIndex(map->pixelGroup, i, map->positions[i], &sourceIndex) ? sourceIndex : NoPixel;
+        }
+
+        map->version = version;
+    }
+
+protected:
+    //rounds the value to the step and flags the maps for a rebuild when the rounded value changed
+    bool UpdateParameter(float* parameter, float value, float step){
+        float quantized = roundf(value / step) * step;
+
+        if (quantized == *parameter) return false;
+
+        *parameter = quantized;
+        version++;
+
+        return true;
+    }
+
+    //exact version, for parameters that are cheap enough to rebuild the map for on every change
+    bool UpdateParameter(float* parameter, float value){
+        if (value == *parameter) return false;
+
+        *parameter = value;
+        version++;
+
+        return true;
+    }
+
+    void Invalidate(){
+        version++;
+    }
+
+    //called once per apply, time varying terms are evaluated here instead of per pixel
+    virtual void UpdateParameters(){}
+
+    //position is the pixel coordinate relative to the group center
+    virtual bool GetSourceIndex(IPixelGroup* pixelGroup, unsigned int count, Vector2D position, unsigned int* sourceIndex) = 0;
+
+public:
+    DisplacementEffect(){}
+
+    ~DisplacementEffect(){
+        for (uint8_t i = 0; i < maxGroups; i++){
+            delete[] maps[i].sources;
+            delete[] maps[i].positions;
+        }
+    }
+
+    void Apply(IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output) override {
+        UpdateParameters();
+
+        DisplacementMap* map = GetMap(pixelGroup);
+
+        if (map->version != version || map->pixelCount != pixelGroup->GetPixelCount()) BuildMap(map);
+
+        uint16_t* sources = map->sources;
+
+        for (unsigned int i = 0; i < map->pixelCount; i++){
+            if (sources[i] == NoPixel) output[i] = RGBColor();
+            else output[i] = input[sources[i]];
+        }
+    }
+};
@@ -1,10 +1,17 @@
 #pragma once
 
 #include "..\..\Camera\Pixels\IPixelGroup.h"
+#include "..\..\Utils\Time\FrameContext.h"
+#include "..\..\Utils\PixelKernels.h"
 
 class Effect {
 protected:
     float ratio = 0.0f;
+    FrameContext* frame = nullptr;//set for each apply, nullptr falls back to the clock
+
+    int32_t Random(int32_t minimum, int32_t maximum){
+        return frame ? frame->Random(minimum, maximum) : random(minimum, maximum);
+    }
 
 public:
     Effect(){}
@@ -13,6 +20,45 @@ public:
         this->ratio = Mathematics::Constrain(ratio, 0.0f, 1.0f);
     }
 
-    virtual void ApplyEffect(IPixelGroup* pixelGroup) = 0;
+    float GetRatio(){
+        return ratio;
+    }
+
+    void SetFrameContext(FrameContext* frame){
+        this->frame = frame;
+    }
+
+    //reads input and writes every pixel of output, input may be used as scratch
+    virtual void Apply(IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output){
+        PixelKernels::Copy(input, output, pixelGroup->GetPixelCount());
+    }
+
+    //runs the effect into the color buffer and swaps it in, no copy back
+    virtual void ApplyEffect(IPixelGroup* pixelGroup){
+        Apply(pixelGroup, pixelGroup->GetColors(), pixelGroup->GetColorBuffer());
+
+        pixelGroup->SwapBuffers();
+    }
+
+    //applies with the time and random sequence of the given frame
+    void ApplyEffect(IPixelGroup* pixelGroup, FrameContext* frame){
+        SetFrameContext(frame);
+
+        ApplyEffect(pixelGroup);
+    }
+
+    //effects with no strength are skipped by the effect chain
+    virtual bool IsActive(){
+        return ratio > 0.0f;
+    }
+
+    //color only effects map each pixel on its own and can be fused into one pass
+    virtual bool IsColorOnly(){
+        return false;
+    }
+
+    virtual RGBColor ApplyPixel(const RGBColor& color){
+        return color;
+    }
 
 };
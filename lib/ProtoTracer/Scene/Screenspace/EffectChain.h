@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Effect.h"
+
+//Ordered list of effects applied as one, buffers are swapped between passes instead of copied back
+class EffectChain : public Effect {
+private:
+    Effect** effects;
+    const uint8_t maxEffects;
+    uint8_t effectCount = 0;
+
+    void ApplyColorEffects(IPixelGroup* pixelGroup, uint8_t start, uint8_t end){
+        RGBColor* pixelColors = pixelGroup->GetColors();
+
+        for (uint8_t j = start; j < end; j++){
+            effects[j]->SetFrameContext(frame);
+        }
+
+        for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
+            RGBColor color = pixelColors[i];
+
+            for (uint8_t j = start; j < end; j++){
+                if (effects[j]->IsActive()) color = effects[j]->ApplyPixel(color);
+            }
+
+            pixelColors[i] = color;
+        }
+    }
+
+public:
+    using Effect::ApplyEffect;
+
+    EffectChain(uint8_t maxEffects) : maxEffects(maxEffects) {
+        effects = new Effect*[maxEffects];
+    }
+
+    ~EffectChain(){
+        delete[] effects;
+    }
+
+    void AddEffect(Effect* effect){
+        if (effectCount < maxEffects){
+            effects[effectCount] = effect;
+            effectCount++;
+        }
+    }
+
+    void RemoveEffect(Effect* effect){
+        for (uint8_t i = 0; i < effectCount; i++){
+            if (effects[i] == effect){
+                for (uint8_t j = i; j < effectCount - 1; j++){
+                    effects[j] = effects[j + 1];
+                }
+
+                effectCount--;
+                break;
+            }
+        }
+    }
+
+    void ClearEffects(){
+        effectCount = 0;
+    }
+
+    uint8_t GetEffectCount(){
+        return effectCount;
+    }
+
+    Effect* GetEffect(uint8_t index){
+        return effects[index];
+    }
+
+    bool IsActive() override {
+        for (uint8_t i = 0; i < effectCount; i++){
+            if (effects[i]->IsActive()) return true;
+        }
+
+        return false;
+    }
+
+    //expects input to be the group colors, restores the original buffer order so the caller can swap as usual
+    void Apply(IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output) override {
+        ApplyEffect(pixelGroup);
+
+        RGBColor* result = pixelGroup->GetColors();
+
+        if (result != input) pixelGroup->SwapBuffers();
+
+        PixelKernels::Copy(result, output, pixelGroup->GetPixelCount());
+    }
+
+    void ApplyEffect(IPixelGroup* pixelGroup) override {
+        uint8_t i = 0;
+
+        while (i < effectCount){
+            if (!effects[i]->IsActive()){
+                i++;
+                continue;
+            }
+
+            if (effects[i]->IsColorOnly()){
+                uint8_t end = i + 1;
+
+                while (end < effectCount && (effects[end]->IsColorOnly() || !effects[end]->IsActive())) end++;
+
+                ApplyColorEffects(pixelGroup, i, end);
+
+                i = end;
+            }
+            else{
+                effects[i]->ApplyEffect(pixelGroup, frame);
+
+                i++;
+            }
+        }
+    }
+};
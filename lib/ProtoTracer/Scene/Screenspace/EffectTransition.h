@@ -0,0 +1,230 @@
+#pragma once
+
+#include "Effect.h"
+
+//Crossfades to a newly set effect instead of switching abruptly, outside of a transition it forwards to the current effect
+//while both effects run it reads the headroom the engine reported for the previous frame, without room for a second
+//effect each one is only re-evaluated every other frame and blended with the last result of the other
+class EffectTransition : public Effect {
+public:
+    enum Mode {
+        Auto,//half rate only while the frame budget is short
+        Full,
+        HalfRate
+    };
+
+private:
+    static const uint8_t maxGroups = 4;
+
+    struct TransitionBuffers{
+        IPixelGroup* pixelGroup = nullptr;
+        RGBColor* from = nullptr;
+        RGBColor* to = nullptr;
+        RGBColor* input = nullptr;
+        unsigned int pixelCount = 0;
+        uint32_t transition = 0;
+        bool fromValid = false;
+        bool toValid = false;
+        bool evaluateTo = false;
+    };
+
+    TransitionBuffers buffers[maxGroups];
+    uint8_t nextBuffers = 0;
+
+    Effect* from = nullptr;
+    Effect* to = nullptr;
+    Mode mode = Auto;
+    float duration = 0.5f;
+    float startTime = 0.0f;
+    float progress = 1.0f;
+    bool started = false;//start time is taken on the first frame so it follows the frame clock
+    uint32_t transition = 0;
+    uint32_t fromTime = 0;
+    uint32_t toTime = 0;
+    bool wasFull = true;
+
+    TransitionBuffers* GetBuffers(IPixelGroup* pixelGroup){
+        for (uint8_t i = 0; i < maxGroups; i++){
+            if (buffers[i].pixelGroup == pixelGroup) return &buffers[i];
+        }
+
+        TransitionBuffers* group = &buffers[nextBuffers];
+
+        nextBuffers = (nextBuffers + 1) % maxGroups;
+
+        group->pixelGroup = pixelGroup;
+        group->transition = 0;
+
+        return group;
+    }
+
+    void AllocateBuffers(TransitionBuffers* group, unsigned int pixelCount){
+        if (group->pixelCount == pixelCount) return;
+
+        delete[] group->from;
+        delete[] group->to;
+        delete[] group->input;
+
+        group->from = new RGBColor[pixelCount];
+        group->to = new RGBColor[pixelCount];
+        group->input = new RGBColor[pixelCount];
+        group->pixelCount = pixelCount;
+        group->transition = 0;
+    }
+
+    //runs one side into its buffer and returns the time it took, an inactive side passes the input through
+    uint32_t ApplySide(Effect* effect, IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output){
+        uint32_t start = micros();
+
+        if (effect && effect->IsActive()){
+            effect->SetFrameContext(frame);
+            effect->Apply(pixelGroup, input, output);
+        }
+        else{
+            PixelKernels::Copy(input, output, pixelGroup->GetPixelCount());
+        }
+
+        return micros() - start;
+    }
+
+    bool UseFullRate(){
+        if (mode != Auto) return mode == Full;
+
+        int32_t headroom = frame ? frame->GetHeadroom() : INT32_MAX;
+        uint32_t sideTime = fromTime > toTime ? fromTime : toTime;
+
+        //a full rate frame that fit stays full, a half rate frame needs room for the skipped side before switching back
+        wasFull = headroom >= (wasFull ? 0 : int32_t(sideTime));
+
+        return wasFull;
+    }
+
+    void UpdateProgress(){
+        float time = frame ? frame->GetTime() : FrameContext::GetCurrentTime();
+
+        if (!started){
+            startTime = time - progress * duration;
+            started = true;
+        }
+
+        progress = duration > 0.0f ? Mathematics::Constrain((time - startTime) / duration, 0.0f, 1.0f) : 1.0f;
+
+        if (progress >= 1.0f) from = nullptr;
+    }
+
+public:
+    using Effect::ApplyEffect;
+
+    EffectTransition(float duration = 0.5f) : duration(duration) {}
+
+    ~EffectTransition(){
+        for (uint8_t i = 0; i < maxGroups; i++){
+            delete[] buffers[i].from;
+            delete[] buffers[i].to;
+            delete[] buffers[i].input;
+        }
+    }
+
+    //starts a crossfade from the current effect, setting the effect it is fading from reverses the transition
+    void SetEffect(Effect* effect){
+        if (effect == to) return;
+
+        if (from && effect == from){
+            from = to;
+            to = effect;
+            progress = 1.0f - progress;
+        }
+        else{
+            from = to;
+            to = effect;
+            progress = from ? 0.0f : 1.0f;
+        }
+
+        started = false;
+        transition++;
+    }
+
+    Effect* GetEffect(){
+        return to;
+    }
+
+    void SetDuration(float duration){//seconds
+        this->duration = duration;
+    }
+
+    void SetMode(Mode mode){
+        this->mode = mode;
+    }
+
+    bool IsTransitioning(){
+        return from != nullptr;
+    }
+
+    float GetProgress(){
+        return progress;
+    }
+
+    bool IsActive() override {
+        return from ? (from->IsActive() || (to && to->IsActive())) : (to && to->IsActive());
+    }
+
+    void Apply(IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output) override {
+        if (from) UpdateProgress();
+
+        if (!from){
+            ApplySide(to, pixelGroup, input, output);
+            return;
+        }
+
+        unsigned int pixelCount = pixelGroup->GetPixelCount();
+        TransitionBuffers* group = GetBuffers(pixelGroup);
+
+        AllocateBuffers(group, pixelCount);
+
+        if (group->transition != transition){
+            group->transition = transition;
+            group->fromValid = false;
+            group->toValid = false;
+        }
+
+        bool full = UseFullRate() || !group->fromValid || !group->toValid;
+
+        if (full){
+            //effects may use their input as scratch, so the second side gets a restored copy
+            PixelKernels::Copy(input, group->input, pixelCount);
+
+            fromTime = ApplySide(from, pixelGroup, input, group->from);
+
+            PixelKernels::Copy(group->input, input, pixelCount);
+
+            toTime = ApplySide(to, pixelGroup, input, group->to);
+
+            group->fromValid = true;
+            group->toValid = true;
+        }
+        else if (group->evaluateTo){
+            toTime = ApplySide(to, pixelGroup, input, group->to);
+        }
+        else{
+            fromTime = ApplySide(from, pixelGroup, input, group->from);
+        }
+
+        group->evaluateTo = !group->evaluateTo;
+
+        PixelKernels::Lerp(group->from, group->to, output, pixelCount, PixelKernels::GetWeight(progress));
+    }
+
+    void ApplyEffect(IPixelGroup* pixelGroup) override {
+        if (from) UpdateProgress();
+
+        if (!from){//nothing to blend, the current effect runs in place without the extra buffers
+            if (to && to->IsActive()) to->ApplyEffect(pixelGroup, frame);
+
+            return;
+        }
+
+        Apply(pixelGroup, pixelGroup->GetColors(), pixelGroup->GetColorBuffer());
+
+        pixelGroup->SwapBuffers();
+    }
+};
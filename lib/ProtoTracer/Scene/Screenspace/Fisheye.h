@@ -1,72 +1,76 @@
 #pragma once
 
-#include "Effect.h"
+#include "DisplacementEffect.h"
 #include "..\..\Utils\Signals\FunctionGenerator.h"
 
-class Fisheye: public Effect {
+class Fisheye: public DisplacementEffect {
 private:
+    static const uint16_t tableSize = 256;
+    static constexpr float tableRange = 4.0f;//distances up to four half widths come from the table, past that the displacement leaves the layout
+    static constexpr float maxMagnitude = 4096.0f;//pixel steps, past every layout, keeps high warps finite instead of inf and NaN before the int cast
+
     Vector2D offset = Vector2D(0.0f, 0.0f);
     float amplitude;
+    float halfWidth = 48.0f;
+    float magnitudes[tableSize + 1];//(distance / halfWidth)^amplitude over the table range
     FunctionGenerator fGenSize = FunctionGenerator(FunctionGenerator::Sine, 1.0f, 48.0f, 2.3f);
     FunctionGenerator fGenX = FunctionGenerator(FunctionGenerator::Sine, -96.0f, 96.0f, 2.7f);
     FunctionGenerator fGenY = FunctionGenerator(FunctionGenerator::Sine, -96.0f, 96.0f, 1.7f);
     FunctionGenerator fGenWarp = FunctionGenerator(FunctionGenerator::Sine, 1.0f, 100.0f, 3.7f);
 
-public:
-    Fisheye(float amplitude = 0.5f) : amplitude(amplitude) {}
+    void UpdateTable(){
+        for (uint16_t i = 0; i <= tableSize; i++){
+            magnitudes[i] = Mathematics::Constrain(powf(float(i) * tableRange / float(tableSize), amplitude), 0.0f, maxMagnitude);
+        }
+    }
 
-    void SetPosition(Vector2D offset){
-        this->offset = offset;
+    float GetMagnitude(float ratio){
+        float x = ratio * (float(tableSize) / tableRange);
+
+        if (x >= float(tableSize)) return Mathematics::Constrain(powf(ratio, amplitude), 0.0f, maxMagnitude);
+
+        uint16_t index = uint16_t(x);
+
+        return magnitudes[index] + (magnitudes[index + 1] - magnitudes[index]) * (x - float(index));
     }
 
-    void SetAmplitude(float amplitude) {
-        this->amplitude = amplitude;
+protected:
+    //offset and warp change every frame, powf runs once per table entry instead of once per pixel so a rebuild stays cheap
+    void UpdateParameters() override {
+        if (UpdateParameter(&amplitude, fGenWarp.Update(frame) * ratio)) UpdateTable();
+
+        UpdateParameter(&offset.X, fGenX.Update(frame) * ratio);
+        UpdateParameter(&offset.Y, fGenY.Update(frame) * ratio);
     }
 
-    void ApplyEffect(IPixelGroup* pixelGroup) override {
-        RGBColor* pixelColors = pixelGroup->GetColors();
-        RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
-        Vector2D mid = pixelGroup->GetCenterCoordinate();
-        float halfWidth = 48.0f;//fGenSize.Update();
-        unsigned int tIndex = 0;
-
-        amplitude = fGenWarp.Update() * ratio;
-
-        offset.X = fGenX.Update() * ratio;
-        offset.Y = fGenY.Update() * ratio;
-
-        for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
-            Vector2D pos = pixelGroup->GetCoordinate(i) + offset;
-            Vector2D dif = pos - mid;
-            float distance = fabsf(pos.CalculateEuclideanDistance(mid));
-            
-            float r = distance / halfWidth;
-            float theta = atan2(dif.Y, dif.X);
-            float newDistance = powf(r, amplitude);
-
-            int offsetX = (int)(newDistance * cosf(theta));
-            int offsetY = (int)(newDistance * sinf(theta));
-
-            // Use this function to find the index of the pixel at the offset x y pixel
-            if(pixelGroup->GetOffsetXYIndex(i, &tIndex, offsetX, offsetY)){
-                colorBuffer[i].R = pixelColors[tIndex].R;// copy the current pixel color into the buffer
-                colorBuffer[i].G = pixelColors[tIndex].G;
-                colorBuffer[i].B = pixelColors[tIndex].B;
-            }
-            else{
-                colorBuffer[i].R = 0;// copy the current pixel color into the buffer
-                colorBuffer[i].G = 0;
-                colorBuffer[i].B = 0;
-            }
+    bool GetSourceIndex(IPixelGroup* pixelGroup, unsigned int count, Vector2D position, unsigned int* sourceIndex) override {
+        Vector2D dif = position + offset;
+        float distance = sqrtf(dif.X * dif.X + dif.Y * dif.Y);
 
+        if (distance < Mathematics::EPSILON){
+            *sourceIndex = count;
+            return true;
         }
 
-        for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
-            pixelColors[i].R = colorBuffer[i].R;
-            pixelColors[i].G = colorBuffer[i].G;
-            pixelColors[i].B = colorBuffer[i].B;
-        }
+        //r^amplitude along the unit direction, dif / distance replaces cos and sin of atan2
+        float scale = GetMagnitude(distance / halfWidth) / distance;
+
+        return pixelGroup->GetOffsetXYIndex(count, sourceIndex, (int)(dif.X * scale), (int)(dif.Y * scale));
     }
 
-};
+public:
+    Fisheye(float amplitude = 0.5f) : amplitude(amplitude) {
+        UpdateTable();
+    }
+
+    void SetPosition(Vector2D offset){
+        this->offset = offset;
+        Invalidate();
+    }
 
+    void SetAmplitude(float amplitude) {
+        this->amplitude = amplitude;
+        UpdateTable();
+        Invalidate();
+    }
+};
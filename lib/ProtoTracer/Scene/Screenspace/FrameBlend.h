@@ -0,0 +1,26 @@
+#pragma once
+
+#include "TemporalEffect.h"
+
+//Exponential blend of each frame into the previous output, smooths low render rates at the cost of some lag
+class FrameBlend : public TemporalEffect {
+private:
+    float smoothing;
+
+protected:
+    void ApplyHistory(RGBColor* input, RGBColor* output, uint32_t* history, unsigned int pixelCount) override {
+        uint16_t weight = uint16_t(Mathematics::Constrain(1.0f - smoothing * ratio, 1.0f / 16.0f, 1.0f) * 256.0f);
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            history[i] = Blend(Pack(input[i]), history[i], weight);
+            output[i] = Unpack(history[i]);
+        }
+    }
+
+public:
+    FrameBlend(float smoothing = 0.75f) : smoothing(smoothing) {}
+
+    void SetSmoothing(float smoothing){//0 shows only the new frame, 1 holds the old frames as long as possible
+        this->smoothing = smoothing;
+    }
+};
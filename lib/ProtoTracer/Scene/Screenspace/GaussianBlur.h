@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Effect.h"
+#include "BlurKernel.h"
+
+class GaussianBlur: public Effect {
+private:
+    const uint8_t pixels;
+
+    uint16_t GetRadius(){
+        return BlurKernel::GetGaussianRadius(uint16_t(Mathematics::Map(ratio, 0.0f, 1.0f, 1.0f, float(pixels / 2))));
+    }
+
+public:
+    using Effect::ApplyEffect;
+
+    GaussianBlur(uint8_t pixels) : pixels(pixels){}
+
+    void Apply(IPixelGroup* pixelGroup, RGBColor* pixelColors, RGBColor* colorBuffer) override {
+        ApplyEffect(pixelGroup, pixelColors, colorBuffer);
+
+        PixelKernels::Copy(pixelColors, colorBuffer, pixelGroup->GetPixelCount());
+    }
+
+    //separable, the horizontal result ends in the buffer and the vertical result back in the pixel colors so no swap is needed
+    void ApplyEffect(IPixelGroup* pixelGroup, RGBColor* pixelColors, RGBColor* colorBuffer){
+        uint16_t radius = GetRadius();
+
+        BlurKernel::Gaussian(pixelGroup, pixelColors, colorBuffer, BlurKernel::Horizontal, radius);
+        BlurKernel::Gaussian(pixelGroup, colorBuffer, pixelColors, BlurKernel::Vertical, radius);
+    }
+
+    void ApplyEffect(IPixelGroup* pixelGroup) override {
+        ApplyEffect(pixelGroup, pixelGroup->GetColors(), pixelGroup->GetColorBuffer());
+    }
+};
@@ -9,17 +9,15 @@ private:
 public:
     GlitchX(uint8_t pixels) : pixels(pixels){}
 
-    void ApplyEffect(IPixelGroup* pixelGroup) override {
-        RGBColor* pixelColors = pixelGroup->GetColors();
-        RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
+    void Apply(IPixelGroup* pixelGroup, RGBColor* pixelColors, RGBColor* colorBuffer) override {
 
         for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
             unsigned int index = i;
             unsigned int tIndex = 0;
             bool valid = true;
             int blurRange = Mathematics::Map(ratio, 0.0f, 1.0f, 1.0f, float(pixels / 2));
-            int randX = random(-blurRange, blurRange);
-            int randSkip = random(1, blurRange);
+            int randX = Random(-blurRange, blurRange);
+            int randSkip = Random(1, blurRange);
 
             valid = pixelGroup->GetOffsetXIndex(index, &tIndex, randX);
 
@@ -45,12 +43,6 @@ public:
                 if(i >= pixelGroup->GetPixelCount()) break;
             }
         }
-
-        for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
-            pixelColors[i].R = colorBuffer[i].R;
-            pixelColors[i].G = colorBuffer[i].G;
-            pixelColors[i].B = colorBuffer[i].B;
-        }
     }
 
 };
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "TemporalEffect.h"
+
+//Averages each frame with the previous input frame, unlike FrameBlend the output never feeds back so nothing lingers past one frame
+class MotionBlur : public TemporalEffect {
+protected:
+    void ApplyHistory(RGBColor* input, RGBColor* output, uint32_t* history, unsigned int pixelCount) override {
+        uint16_t weight = uint16_t(256.0f - ratio * 128.0f);
+
+        for (unsigned int i = 0; i < pixelCount; i++){
+            uint32_t current = Pack(input[i]);
+
+            output[i] = Unpack(Blend(current, history[i], weight));
+            history[i] = current;
+        }
+    }
+
+public:
+    MotionBlur(){}
+};
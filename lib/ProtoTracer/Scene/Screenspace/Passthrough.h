@@ -8,5 +8,8 @@ public:
 
     void ApplyEffect(IPixelGroup* pixelGroup) override {}
 
-};
+    bool IsActive() override {
+        return false;
+    }
 
+};
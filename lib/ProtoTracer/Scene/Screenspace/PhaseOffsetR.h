@@ -13,12 +13,10 @@ private:
 public:
     PhaseOffsetR(uint8_t pixels) : pixels(pixels){}
 
-    void ApplyEffect(IPixelGroup* pixelGroup) override{
+    void Apply(IPixelGroup* pixelGroup, RGBColor* pixelColors, RGBColor* colorBuffer) override {
         unsigned int pixelCount = pixelGroup->GetPixelCount();
-        RGBColor* pixelColors = pixelGroup->GetColors();
-        RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
 
-        float rotation = fGenRotation.Update();
+        float rotation = fGenRotation.Update(frame);
         float range = (pixels - 1) * ratio + 1;
         float phase120 = 2.0f * Mathematics::MPI * 0.333f;
         float phase240 = 2.0f * Mathematics::MPI * 0.666f;
@@ -28,18 +26,21 @@ public:
         float mpiR2G = mpiR2R + phase120;
         float mpiR1B = mpiR1R + phase240;
         float mpiR2B = mpiR2R + phase240;
+        float offset1 = fGenPhase1.Update(frame);
+        float offset2 = fGenPhase2.Update(frame);
+        float phase1R = mpiR1R * offset1, phase1G = mpiR1G * offset1, phase1B = mpiR1B * offset1;
+        float phase2R = mpiR2R * offset2, phase2G = mpiR2G * offset2, phase2B = mpiR2B * offset2;
 
         for (unsigned int i = 0; i < pixelCount; i++){
             unsigned int indexR, indexG, indexB;
             bool validR, validG, validB;
 
-            float coordX = pixelGroup->GetCoordinate(i).X / 10.0f;
-            float coordY = pixelGroup->GetCoordinate(i).Y / 5.0f;
-            float offset1 = fGenPhase1.Update();
-            float offset2 = fGenPhase2.Update();
-            float sineR = sinf(coordX + mpiR1R * offset1) + cosf(coordY + mpiR2R * offset2);
-            float sineG = sinf(coordX + mpiR1G * offset1) + cosf(coordY + mpiR2G * offset2);
-            float sineB = sinf(coordX + mpiR1B * offset1) + cosf(coordY + mpiR2B * offset2);
+            Vector2D coordinate = pixelGroup->GetCoordinate(i);
+            float coordX = coordinate.X / 10.0f;
+            float coordY = coordinate.Y / 5.0f;
+            float sineR = sinf(coordX + phase1R) + cosf(coordY + phase2R);
+            float sineG = sinf(coordX + phase1G) + cosf(coordY + phase2G);
+            float sineB = sinf(coordX + phase1B) + cosf(coordY + phase2B);
 
             uint8_t blurRangeR = Mathematics::Constrain(uint8_t(Mathematics::Map(sineR, -1.0f, 1.0f, 1.0f, range)), uint8_t(1), uint8_t(range));
             uint8_t blurRangeG = Mathematics::Constrain(uint8_t(Mathematics::Map(sineG, -1.0f, 1.0f, 1.0f, range)), uint8_t(1), uint8_t(range));
@@ -59,11 +60,6 @@ public:
             else colorBuffer[i].B = 0;
         }
         
-        for (unsigned int i = 0; i < pixelCount; i++){
-            pixelColors[i].R = colorBuffer[i].R;
-            pixelColors[i].G = colorBuffer[i].G;
-            pixelColors[i].B = colorBuffer[i].B;
-        }
     }
 };
 
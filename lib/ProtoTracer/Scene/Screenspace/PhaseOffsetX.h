@@ -11,17 +11,20 @@ private:
 public:
     PhaseOffsetX(uint8_t pixels) : pixels(pixels){}
 
-    void ApplyEffect(IPixelGroup* pixelGroup) override {
-        RGBColor* pixelColors = pixelGroup->GetColors();
-        RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
+    void Apply(IPixelGroup* pixelGroup, RGBColor* pixelColors, RGBColor* colorBuffer) override {
+        unsigned int pixelCount = pixelGroup->GetPixelCount();
 
-        for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
-            float range = ((pixels - 1) * ratio + 1) / 2.0f;
+        //the phase only changes between frames, so it is evaluated once instead of per pixel
+        float range = ((pixels - 1) * ratio + 1) / 2.0f;
+        float phaseR = 2.0f * Mathematics::MPI * fGenPhase.Update(frame) * 8.0f;
+        float phaseG = phaseR + 2.0f * Mathematics::MPI * 0.333f;
+        float phaseB = phaseR + 2.0f * Mathematics::MPI * 0.666f;
+
+        for (unsigned int i = 0; i < pixelCount; i++){
             float coordY = pixelGroup->GetCoordinate(i).Y / 10.0f;
-            float mpiR = 2.0f * Mathematics::MPI * fGenPhase.Update();
-            float sineR = sinf(coordY + mpiR * 8.0f);
-            float sineG = sinf(coordY + mpiR * 8.0f + 2.0f * Mathematics::MPI * 0.333f);
-            float sineB = sinf(coordY + mpiR * 8.0f + 2.0f * Mathematics::MPI * 0.666f);
+            float sineR = sinf(coordY + phaseR);
+            float sineG = sinf(coordY + phaseG);
+            float sineB = sinf(coordY + phaseB);
 
             int8_t blurRangeR = Mathematics::Constrain(int8_t(Mathematics::Map(sineR, -1.0f, 1.0f, -range, range)), int8_t(-range), int8_t(range));
             int8_t blurRangeG = Mathematics::Constrain(int8_t(Mathematics::Map(sineG, -1.0f, 1.0f, -range, range)), int8_t(-range), int8_t(range));
@@ -42,12 +45,6 @@ public:
             if(validB) colorBuffer[i].B = pixelColors[indexB].B;
             else colorBuffer[i].B = 0;
         }
-
-        for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
-            pixelColors[i].R = colorBuffer[i].R;
-            pixelColors[i].G = colorBuffer[i].G;
-            pixelColors[i].B = colorBuffer[i].B;
-        }
     }
 
 };
@@ -11,16 +11,20 @@ private:
 public:
     PhaseOffsetY(uint8_t pixels) : pixels(pixels){}
 
-    void ApplyEffect(IPixelGroup* pixelGroup){
-        RGBColor* pixelColors = pixelGroup->GetColors();
+    void Apply(IPixelGroup* pixelGroup, RGBColor* pixelColors, RGBColor* colorBuffer) override {
+        unsigned int pixelCount = pixelGroup->GetPixelCount();
 
-        for (unsigned int i = 0; i < pixelGroup->GetPixelCount(); i++){
-            float range = (pixels - 1) * ratio + 1;
+        //the phase only changes between frames, so it is evaluated once instead of per pixel
+        float range = (pixels - 1) * ratio + 1;
+        float phaseR = 2.0f * Mathematics::MPI * fGenPhase.Update(frame) * 8.0f;
+        float phaseG = phaseR + 2.0f * Mathematics::MPI * 0.333f;
+        float phaseB = phaseR + 2.0f * Mathematics::MPI * 0.666f;
+
+        for (unsigned int i = 0; i < pixelCount; i++){
             float coordX = pixelGroup->GetCoordinate(i).X / 10.0f;
-            float mpiR = 2.0f * Mathematics::MPI * fGenPhase.Update();
-            float sineR = sinf(coordX + mpiR * 8.0f);
-            float sineG = sinf(coordX + mpiR * 8.0f + 2.0f * Mathematics::MPI * 0.333f);
-            float sineB = sinf(coordX + mpiR * 8.0f + 2.0f * Mathematics::MPI * 0.666f);
+            float sineR = sinf(coordX + phaseR);
+            float sineG = sinf(coordX + phaseG);
+            float sineB = sinf(coordX + phaseB);
 
             uint8_t blurRangeR = Mathematics::Constrain(uint8_t(Mathematics::Map(sineR, -1.0f, 1.0f, 1.0f, range)), uint8_t(1), uint8_t(range));
             uint8_t blurRangeG = Mathematics::Constrain(uint8_t(Mathematics::Map(sineG, -1.0f, 1.0f, 1.0f, range)), uint8_t(1), uint8_t(range));
@@ -32,14 +36,14 @@ public:
             bool validG = pixelGroup->GetOffsetYIndex(i, &indexG, blurRangeG);
             bool validB = pixelGroup->GetOffsetYIndex(i, &indexB, blurRangeB);
 
-            if(validR) pixelColors[i].R = pixelColors[indexR].R;
-            else pixelColors[i].R = 0;
+            if(validR) colorBuffer[i].R = pixelColors[indexR].R;
+            else colorBuffer[i].R = 0;
             
-            if(validG) pixelColors[i].G = pixelColors[indexG].G;
-            else pixelColors[i].G = 0;
+            if(validG) colorBuffer[i].G = pixelColors[indexG].G;
+            else colorBuffer[i].G = 0;
             
-            if(validB) pixelColors[i].B = pixelColors[indexB].B;
-            else pixelColors[i].B = 0;
+            if(validB) colorBuffer[i].B = pixelColors[indexB].B;
+            else colorBuffer[i].B = 0;
         }
     }
 
@@ -13,12 +13,10 @@ private:
 public:
     ShiftR(uint8_t pixels) : pixels(pixels){}
 
-    void ApplyEffect(IPixelGroup* pixelGroup) override{
+    void Apply(IPixelGroup* pixelGroup, RGBColor* pixelColors, RGBColor* colorBuffer) override {
         unsigned int pixelCount = pixelGroup->GetPixelCount();
-        RGBColor* pixelColors = pixelGroup->GetColors();
-        RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
 
-        float rotation = fGenRotation.Update();
+        float rotation = fGenRotation.Update(frame);
 
         for (unsigned int i = 0; i < pixelCount; i++){
             unsigned int indexR, indexG, indexB;
@@ -40,10 +38,5 @@ public:
             else colorBuffer[i].B = 0;
         }
         
-        for (unsigned int i = 0; i < pixelCount; i++){
-            pixelColors[i].R = colorBuffer[i].R;
-            pixelColors[i].G = colorBuffer[i].G;
-            pixelColors[i].B = colorBuffer[i].B;
-        }
     }
 };
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Effect.h"
+
+//Effects that carry colors across frames, each pixel group keeps its own packed 0x00RRGGBB history
+class TemporalEffect : public Effect {
+private:
+    static const uint8_t maxGroups = 4;
+
+    struct History{
+        IPixelGroup* pixelGroup = nullptr;
+        uint32_t* colors = nullptr;
+        unsigned int pixelCount = 0;
+        uint32_t lastMicros = 0;
+        bool valid = false;
+    };
+
+    History histories[maxGroups];
+    uint8_t nextHistory = 0;
+    uint32_t resetGap = 250000;//micros
+
+    History* GetHistory(IPixelGroup* pixelGroup){
+        for (uint8_t i = 0; i < maxGroups; i++){
+            if (histories[i].pixelGroup == pixelGroup) return &histories[i];
+        }
+
+        History* history = &histories[nextHistory];
+
+        nextHistory = (nextHistory + 1) % maxGroups;
+
+        history->pixelGroup = pixelGroup;
+        history->valid = false;
+
+        return history;
+    }
+
+protected:
+    static uint32_t Pack(const RGBColor& color){
+        return (uint32_t(color.R) << 16) | (uint32_t(color.G) << 8) | uint32_t(color.B);
+    }
+
+    static RGBColor Unpack(uint32_t color){
+        return RGBColor((color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF);
+    }
+
+    //weight of a out of 256, red and blue share one multiply and green takes the other
+    static uint32_t Blend(uint32_t a, uint32_t b, uint16_t weight){
+        uint32_t inverse = 256 - weight;
+        uint32_t redBlue = (((a & 0xFF00FF) * weight + (b & 0xFF00FF) * inverse) >> 8) & 0xFF00FF;
+        uint32_t green = (((a & 0x00FF00) * weight + (b & 0x00FF00) * inverse) >> 8) & 0x00FF00;
+
+        return redBlue | green;
+    }
+
+    static uint32_t Scale(uint32_t color, uint16_t scale){
+        return ((((color & 0xFF00FF) * scale) >> 8) & 0xFF00FF) | ((((color & 0x00FF00) * scale) >> 8) & 0x00FF00);
+    }
+
+    //per channel maximum without unpacking, a guard bit above red and blue survives the subtraction where a is not smaller than b
+    static uint32_t Max(uint32_t a, uint32_t b){
+        uint32_t lanes = (((a & 0xFF00FF) | 0x1000100) - (b & 0xFF00FF)) & 0x1000100;
+        uint32_t mask = ((lanes >> 8) * 0xFF) | ((a & 0x00FF00) >= (b & 0x00FF00) ? 0x00FF00 : 0);
+
+        return (a & mask) | (b & ~mask);
+    }
+
+    //reads the frame input, writes the frame output and updates the history in the same pass
+    virtual void ApplyHistory(RGBColor* input, RGBColor* output, uint32_t* history, unsigned int pixelCount) = 0;
+
+public:
+    TemporalEffect(){}
+
+    ~TemporalEffect(){
+        for (uint8_t i = 0; i < maxGroups; i++){
+            delete[] histories[i].colors;
+        }
+    }
+
+    //longest pause between two applies to the same group that keeps its history, groups on rate limited cameras
+    //and half rate transitions skip frames by design, only a pause this long means the effect was off or the clock jumped
+    void SetResetGap(uint32_t resetGap){
+        this->resetGap = resetGap;
+    }
+
+    //drops the history so the next frame starts clean
+    void Reset(){
+        for (uint8_t i = 0; i < maxGroups; i++){
+            histories[i].valid = false;
+        }
+    }
+
+    void Apply(IPixelGroup* pixelGroup, RGBColor* input, RGBColor* output) override {
+        History* history = GetHistory(pixelGroup);
+        unsigned int pixelCount = pixelGroup->GetPixelCount();
+
+        if (history->pixelCount != pixelCount){
+            delete[] history->colors;
+
+            history->colors = new uint32_t[pixelCount];
+            history->pixelCount = pixelCount;
+            history->valid = false;
+        }
+
+        uint32_t now = frame ? frame->GetMicros() : FrameContext::GetCurrentMicros();
+
+        //a long pause means the effect was switched off, old colors would show up as a ghost, a clock reset wraps to a large gap
+        if (history->valid && now - history->lastMicros > resetGap) history->valid = false;
+
+        if (!history->valid){
+            for (unsigned int i = 0; i < pixelCount; i++){
+                history->colors[i] = Pack(input[i]);
+            }
+
+            history->valid = true;
+        }
+
+        history->lastMicros = now;
+
+        ApplyHistory(input, output, history->colors, pixelCount);
+    }
+};
@@ -10,10 +10,8 @@ private:
 public:
     Test(){}
 
-    void ApplyEffect(IPixelGroup* pixelGroup){
+    void Apply(IPixelGroup* pixelGroup, RGBColor* pixelColors, RGBColor* colorBuffer) override {
         unsigned int pixelCount = pixelGroup->GetPixelCount();
-        RGBColor* pixelColors = pixelGroup->GetColors();
-        RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
 
         for (unsigned int i = 0; i < pixelCount; i++){
             colorBuffer[i].R = 0;
@@ -29,7 +27,7 @@ public:
             unsigned int upIndex = i;
             unsigned int downIndex = i;
 
-            uint8_t d = fGenD.Update();
+            uint8_t d = fGenD.Update(frame);
 
             bool validLeft = pixelGroup->GetLeftIndex(leftIndex, &leftIndex);
             bool validRight = pixelGroup->GetRightIndex(rightIndex, &rightIndex);
@@ -51,13 +49,6 @@ public:
                 colorBuffer[downIndex].B = colorBuffer[downIndex].B == 100 ? 100 : d;
             }
         }
-
-        //////////////////////////////////////
-        for (unsigned int i = 0; i < pixelCount; i++){
-            pixelColors[i].R = colorBuffer[i].R;
-            pixelColors[i].G = colorBuffer[i].G;
-            pixelColors[i].B = colorBuffer[i].B;
-        }
     }
 };
 
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <Arduino.h>
+#include "RGBColor.h"
+
+//Cortex-M7 and other DSP cores work on four channels per word, desktop builds on sixteen per vector
+//arm_acle.h only has the SIMD32 intrinsics from GCC 10, older Teensy toolchains define the feature macro but fall back to the scalar path
+#if defined(__ARM_FEATURE_SIMD32) && (defined(__clang__) || !defined(__GNUC__) || __GNUC__ >= 10)
+#include <arm_acle.h>
+#define PIXELKERNELS_DSP
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define PIXELKERNELS_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define PIXELKERNELS_NEON
+#endif
+
+//Channel parallel operations on spans of RGBColor, every channel is handled the same so a span is just count * 3 bytes
+//Inputs and output may be the same span. Scale and lerp weights are out of 256.
+class PixelKernels {
+private:
+    static_assert(sizeof(RGBColor) == 3, "pixel kernels expect tightly packed RGBColor");
+
+#if defined(PIXELKERNELS_DSP)
+    typedef uint32_t Lane;
+    static const uint8_t laneWidth = 4;
+
+    static Lane Load(const uint8_t* data){
+        Lane lane;
+
+        memcpy(&lane, data, sizeof(Lane));//unaligned word load on M7
+
+        return lane;
+    }
+
+    static void Store(uint8_t* data, Lane lane){
+        memcpy(data, &lane, sizeof(Lane));
+    }
+#elif defined(PIXELKERNELS_SSE2)
+    typedef __m128i Lane;
+    static const uint8_t laneWidth = 16;
+
+    static Lane Load(const uint8_t* data){
+        return _mm_loadu_si128((const __m128i*)data);
+    }
+
+    static void Store(uint8_t* data, Lane lane){
+        _mm_storeu_si128((__m128i*)data, lane);
+    }
+
+    static Lane MultiplyHigh(Lane lane, __m128i weight, __m128i zero){//bytes times a 16 bit weight, shifted back down by 8
+        __m128i low = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(lane, zero), weight), 8);
+        __m128i high = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(lane, zero), weight), 8);
+
+        return _mm_packus_epi16(low, high);
+    }
+#elif defined(PIXELKERNELS_NEON)
+    typedef uint8x16_t Lane;
+    static const uint8_t laneWidth = 16;
+
+    static Lane Load(const uint8_t* data){
+        return vld1q_u8(data);
+    }
+
+    static void Store(uint8_t* data, Lane lane){
+        vst1q_u8(data, lane);
+    }
+#endif
+
+    struct AddOp{
+        uint8_t Byte(uint8_t a, uint8_t b){ return a + b; }
+#if defined(PIXELKERNELS_DSP)
+        Lane Vector(Lane a, Lane b){ return __uadd8(a, b); }
+#elif defined(PIXELKERNELS_SSE2)
+        Lane Vector(Lane a, Lane b){ return _mm_add_epi8(a, b); }
+#elif defined(PIXELKERNELS_NEON)
+        Lane Vector(Lane a, Lane b){ return vaddq_u8(a, b); }
+#endif
+    };
+
+    struct AddSaturateOp{
+        uint8_t Byte(uint8_t a, uint8_t b){ return a + b > 255 ? 255 : a + b; }
+#if defined(PIXELKERNELS_DSP)
+        Lane Vector(Lane a, Lane b){ return __uqadd8(a, b); }
+#elif defined(PIXELKERNELS_SSE2)
+        Lane Vector(Lane a, Lane b){ return _mm_adds_epu8(a, b); }
+#elif defined(PIXELKERNELS_NEON)
+        Lane Vector(Lane a, Lane b){ return vqaddq_u8(a, b); }
+#endif
+    };
+
+    struct SubtractSaturateOp{
+        uint8_t Byte(uint8_t a, uint8_t b){ return a > b ? a - b : 0; }
+#if defined(PIXELKERNELS_DSP)
+        Lane Vector(Lane a, Lane b){ return __uqsub8(a, b); }
+#elif defined(PIXELKERNELS_SSE2)
+        Lane Vector(Lane a, Lane b){ return _mm_subs_epu8(a, b); }
+#elif defined(PIXELKERNELS_NEON)
+        Lane Vector(Lane a, Lane b){ return vqsubq_u8(a, b); }
+#endif
+    };
+
+    struct AverageOp{//rounds down on every backend so results match bit for bit
+        uint8_t Byte(uint8_t a, uint8_t b){ return (a + b) >> 1; }
+#if defined(PIXELKERNELS_DSP)
+        Lane Vector(Lane a, Lane b){ return __uhadd8(a, b); }
+#elif defined(PIXELKERNELS_SSE2)
+        Lane Vector(Lane a, Lane b){ return _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1))); }
+#elif defined(PIXELKERNELS_NEON)
+        Lane Vector(Lane a, Lane b){ return vhaddq_u8(a, b); }
+#endif
+    };
+
+    struct MinOp{
+        uint8_t Byte(uint8_t a, uint8_t b){ return a < b ? a : b; }
+#if defined(PIXELKERNELS_DSP)
+        Lane Vector(Lane a, Lane b){ __usub8(a, b); return __sel(b, a); }//usub8 sets the GE flag of each byte where a >= b
+#elif defined(PIXELKERNELS_SSE2)
+        Lane Vector(Lane a, Lane b){ return _mm_min_epu8(a, b); }
+#elif defined(PIXELKERNELS_NEON)
+        Lane Vector(Lane a, Lane b){ return vminq_u8(a, b); }
+#endif
+    };
+
+    struct MaxOp{
+        uint8_t Byte(uint8_t a, uint8_t b){ return a > b ? a : b; }
+#if defined(PIXELKERNELS_DSP)
+        Lane Vector(Lane a, Lane b){ __usub8(a, b); return __sel(a, b); }
+#elif defined(PIXELKERNELS_SSE2)
+        Lane Vector(Lane a, Lane b){ return _mm_max_epu8(a, b); }
+#elif defined(PIXELKERNELS_NEON)
+        Lane Vector(Lane a, Lane b){ return vmaxq_u8(a, b); }
+#endif
+    };
+
+    //a * (256 - weight) + b * weight, with a weight of 0 and b of 256 scale is the same operation
+    struct LerpOp{
+        uint16_t weight;
+
+        uint8_t Byte(uint8_t a, uint8_t b){ return (a * (256 - weight) + b * weight) >> 8; }
+#if defined(PIXELKERNELS_DSP)
+        Lane Vector(Lane a, Lane b){//red and blue style even bytes in one multiply, odd bytes in the other
+            uint32_t inverse = 256 - weight;
+            uint32_t even = (((a & 0x00FF00FF) * inverse + (b & 0x00FF00FF) * weight) >> 8) & 0x00FF00FF;
+            uint32_t odd = (((a >> 8) & 0x00FF00FF) * inverse + ((b >> 8) & 0x00FF00FF) * weight) & 0xFF00FF00;
+
+            return even | odd;
+        }
+#elif defined(PIXELKERNELS_SSE2)
+        Lane Vector(Lane a, Lane b){
+            __m128i zero = _mm_setzero_si128();
+            __m128i w = _mm_set1_epi16(weight);
+            __m128i inverse = _mm_set1_epi16(256 - weight);
+            __m128i low = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), inverse), _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), w));
+            __m128i high = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), inverse), _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), w));
+
+            return _mm_packus_epi16(_mm_srli_epi16(low, 8), _mm_srli_epi16(high, 8));
+        }
+#elif defined(PIXELKERNELS_NEON)
+        Lane Vector(Lane a, Lane b){
+            uint16x8_t low = vmlaq_n_u16(vmulq_n_u16(vmovl_u8(vget_low_u8(a)), 256 - weight), vmovl_u8(vget_low_u8(b)), weight);
+            uint16x8_t high = vmlaq_n_u16(vmulq_n_u16(vmovl_u8(vget_high_u8(a)), 256 - weight), vmovl_u8(vget_high_u8(b)), weight);
+
+            return vcombine_u8(vshrn_n_u16(low, 8), vshrn_n_u16(high, 8));
+        }
+#endif
+    };
+
+    struct ScaleOp{
+        uint16_t scale;
+
+        uint8_t Byte(uint8_t a, uint8_t){ return (a * scale) >> 8; }
+#if defined(PIXELKERNELS_DSP)
+        Lane Vector(Lane a, Lane){
+            return ((((a & 0x00FF00FF) * scale) >> 8) & 0x00FF00FF) | ((((a >> 8) & 0x00FF00FF) * scale) & 0xFF00FF00);
+        }
+#elif defined(PIXELKERNELS_SSE2)
+        Lane Vector(Lane a, Lane){
+            return MultiplyHigh(a, _mm_set1_epi16(scale), _mm_setzero_si128());
+        }
+#elif defined(PIXELKERNELS_NEON)
+        Lane Vector(Lane a, Lane){
+            return vcombine_u8(vshrn_n_u16(vmulq_n_u16(vmovl_u8(vget_low_u8(a)), scale), 8), vshrn_n_u16(vmulq_n_u16(vmovl_u8(vget_high_u8(a)), scale), 8));
+        }
+#endif
+    };
+
+    template<typename Op>
+    static void Run(Op op, const RGBColor* a, const RGBColor* b, RGBColor* output, unsigned int count){
+        const uint8_t* x = (const uint8_t*)a;
+        const uint8_t* y = (const uint8_t*)b;
+        uint8_t* out = (uint8_t*)output;
+        unsigned int length = count * 3;
+        unsigned int i = 0;
+
+#if defined(PIXELKERNELS_DSP) || defined(PIXELKERNELS_SSE2) || defined(PIXELKERNELS_NEON)
+        for (; i + laneWidth <= length; i += laneWidth){
+            Store(out + i, op.Vector(Load(x + i), Load(y + i)));
+        }
+#endif
+
+        for (; i < length; i++){
+            out[i] = op.Byte(x[i], y[i]);
+        }
+    }
+
+    template<typename Op>
+    static RGBColor RunPixel(Op op, const RGBColor& a, const RGBColor& b){
+        return RGBColor(op.Byte(a.R, b.R), op.Byte(a.G, b.G), op.Byte(a.B, b.B));
+    }
+
+public:
+    static void Copy(const RGBColor* input, RGBColor* output, unsigned int count){
+        if (input != output) memcpy((void*)output, (const void*)input, count * sizeof(RGBColor));
+    }
+
+    static void Fill(RGBColor* output, RGBColor color, unsigned int count){
+        for (unsigned int i = 0; i < count; i++){
+            output[i] = color;
+        }
+    }
+
+    static void Add(const RGBColor* a, const RGBColor* b, RGBColor* output, unsigned int count){//wraps around, for values known not to overflow
+        Run(AddOp(), a, b, output, count);
+    }
+
+    static void AddSaturate(const RGBColor* a, const RGBColor* b, RGBColor* output, unsigned int count){
+        Run(AddSaturateOp(), a, b, output, count);
+    }
+
+    static void SubtractSaturate(const RGBColor* a, const RGBColor* b, RGBColor* output, unsigned int count){
+        Run(SubtractSaturateOp(), a, b, output, count);
+    }
+
+    static void Average(const RGBColor* a, const RGBColor* b, RGBColor* output, unsigned int count){
+        Run(AverageOp(), a, b, output, count);
+    }
+
+    static void Min(const RGBColor* a, const RGBColor* b, RGBColor* output, unsigned int count){
+        Run(MinOp(), a, b, output, count);
+    }
+
+    static void Max(const RGBColor* a, const RGBColor* b, RGBColor* output, unsigned int count){
+        Run(MaxOp(), a, b, output, count);
+    }
+
+    static void Lerp(const RGBColor* a, const RGBColor* b, RGBColor* output, unsigned int count, uint16_t weight){
+        Run(LerpOp{ weight }, a, b, output, count);
+    }
+
+    static void Scale(const RGBColor* input, RGBColor* output, unsigned int count, uint16_t scale){
+        Run(ScaleOp{ scale }, input, input, output, count);
+    }
+
+    //single pixel versions for per sample code such as materials
+    static RGBColor Add(const RGBColor& a, const RGBColor& b){
+        return RunPixel(AddOp(), a, b);
+    }
+
+    static RGBColor AddSaturate(const RGBColor& a, const RGBColor& b){
+        return RunPixel(AddSaturateOp(), a, b);
+    }
+
+    static RGBColor SubtractSaturate(const RGBColor& a, const RGBColor& b){
+        return RunPixel(SubtractSaturateOp(), a, b);
+    }
+
+    static RGBColor Average(const RGBColor& a, const RGBColor& b){
+        return RunPixel(AverageOp(), a, b);
+    }
+
+    static RGBColor Min(const RGBColor& a, const RGBColor& b){
+        return RunPixel(MinOp(), a, b);
+    }
+
+    static RGBColor Max(const RGBColor& a, const RGBColor& b){
+        return RunPixel(MaxOp(), a, b);
+    }
+
+    static RGBColor Lerp(const RGBColor& a, const RGBColor& b, uint16_t weight){
+        return RunPixel(LerpOp{ weight }, a, b);
+    }
+
+    static RGBColor Scale(const RGBColor& color, uint16_t scale){
+        return RunPixel(ScaleOp{ scale }, color, color);
+    }
+
+    static uint16_t GetWeight(float ratio){//0 to 1 into the 0 to 256 weights above
+        return uint16_t(Mathematics::Constrain(ratio, 0.0f, 1.0f) * 256.0f);
+    }
+};
@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 #include "..\Math\Mathematics.h"
+#include "..\Time\FrameContext.h"
 
 class FunctionGenerator{
 public:
@@ -57,7 +58,15 @@ public:
     }
 
     float Update(){
-        float currentTime = fmod(micros() / 1000000.0f, period);
+        return Update(FrameContext::GetCurrentTime());
+    }
+
+    float Update(FrameContext* frame){
+        return frame ? Update(frame->GetTime()) : Update();
+    }
+
+    float Update(float time){//time in seconds
+        float currentTime = fmod(time, period);
         float ratio = currentTime / period;
         
         switch(function){
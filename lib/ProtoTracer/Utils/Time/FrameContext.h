@@ -0,0 +1,159 @@
+#pragma once
+
+#include <Arduino.h>
+
+//Time and randomness for one frame, read once and shared by every effect, material and animator rendered in that frame
+class FrameContext{
+private:
+    uint32_t seed = 1;
+    uint32_t state = 1;
+    uint32_t timeMicros = 0;
+    float time = 0.0f;
+    float deltaTime = 0.0f;
+    uint32_t frameCount = 0;
+    uint32_t frameBudget = 0;
+    uint32_t lastFrameTime = 0;
+
+    static FrameContext*& Active(){
+        static FrameContext* active = nullptr;
+
+        return active;
+    }
+
+    static uint32_t Hash(uint32_t value){
+        value ^= value >> 16;
+        value *= 0x7FEB352D;
+        value ^= value >> 15;
+        value *= 0x846CA68B;
+        value ^= value >> 16;
+
+        return value != 0 ? value : 1;
+    }
+
+    void Advance(uint32_t timeMicros){
+        deltaTime = frameCount > 0 ? float(timeMicros - this->timeMicros) / 1000000.0f : 0.0f;
+
+        this->timeMicros = timeMicros;
+        time = float(timeMicros) / 1000000.0f;
+        state = Hash(seed ^ (frameCount * 0x9E3779B9));//same seed and frame number give the same sequence
+
+        frameCount++;
+
+        Active() = this;
+    }
+
+public:
+    FrameContext(uint32_t seed = 1){
+        SetSeed(seed);
+    }
+
+    //starts a frame at the current clock, used for live output
+    void Begin(){
+        Advance(micros());
+    }
+
+    //starts a frame at an injected time, used for captures and offline renders
+    void Begin(uint32_t timeMicros){
+        Advance(timeMicros);
+    }
+
+    //starts the next frame a fixed step after the previous one
+    void Step(float deltaTime){
+        Advance(timeMicros + uint32_t(deltaTime * 1000000.0f));
+    }
+
+    void Reset(uint32_t timeMicros = 0){
+        this->timeMicros = timeMicros;
+        time = float(timeMicros) / 1000000.0f;
+        deltaTime = 0.0f;
+        frameCount = 0;
+    }
+
+    void SetSeed(uint32_t seed){
+        this->seed = seed;
+        state = Hash(seed);
+    }
+
+    uint32_t GetSeed(){
+        return seed;
+    }
+
+    uint32_t GetMicros(){
+        return timeMicros;
+    }
+
+    uint32_t GetMillis(){
+        return timeMicros / 1000;
+    }
+
+    float GetTime(){//seconds
+        return time;
+    }
+
+    float GetDeltaTime(){
+        return deltaTime;
+    }
+
+    uint32_t GetFrameCount(){
+        return frameCount;
+    }
+
+    //budget and duration of the previous frame in micros as reported by the engine, a budget of 0 is unlimited
+    void SetBudget(uint32_t frameBudget, uint32_t lastFrameTime){
+        this->frameBudget = frameBudget;
+        this->lastFrameTime = lastFrameTime;
+    }
+
+    uint32_t GetFrameBudget(){
+        return frameBudget;
+    }
+
+    uint32_t GetLastFrameTime(){
+        return lastFrameTime;
+    }
+
+    //micros left over by the previous frame, negative when it overran
+    int32_t GetHeadroom(){
+        return frameBudget == 0 ? INT32_MAX : int32_t(frameBudget) - int32_t(lastFrameTime);
+    }
+
+    uint32_t NextRandom(){//xorshift32
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        return state;
+    }
+
+    int32_t Random(int32_t minimum, int32_t maximum){//minimum inclusive, maximum exclusive like Arduino random
+        if (maximum <= minimum) return minimum;
+
+        return minimum + int32_t(NextRandom() % uint32_t(maximum - minimum));
+    }
+
+    float RandomFloat(){//0 to 1
+        return float(NextRandom() >> 8) / 16777216.0f;
+    }
+
+    //the most recently begun frame, code without a context passed in reads time from here
+    static FrameContext* GetActive(){
+        return Active();
+    }
+
+    static void SetActive(FrameContext* frame){
+        Active() = frame;
+    }
+
+    //frame time when a frame has begun, otherwise the clock
+    static uint32_t GetCurrentMicros(){
+        return Active() ? Active()->timeMicros : micros();
+    }
+
+    static uint32_t GetCurrentMillis(){
+        return Active() ? Active()->timeMicros / 1000 : millis();
+    }
+
+    static float GetCurrentTime(){
+        return Active() ? Active()->time : float(micros()) / 1000000.0f;
+    }
+};
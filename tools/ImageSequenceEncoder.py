@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+"""Converts an ImageSequence header into a CompressedImageSequence header for ProtoTracer.
+
+Frames are palette indices, keyframes are run length coded and the frames between them only code the pixels that
+changed since the previous frame. The token format is documented in CompressedImageSequence.h, every frame is
+decoded again here and compared against the source before the output is written.
+With --stream a file for StreamingImageSequence is written instead of a header, copy it to the SD card.
+
+Example:
+    python tools/ImageSequenceEncoder.py lib/ProtoTracer/Assets/Textures/Animated/BadApple.h --name BadApple -o lib/ProtoTracer/Assets/Textures/Animated/BadAppleCompressed.h
+    python tools/ImageSequenceEncoder.py lib/ProtoTracer/Assets/Textures/Animated/BadApple.h --name BadApple --stream -o BADAPPLE.PTS
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import time
+
+KEY_FRAME = 0
+DELTA_FRAME = 1
+
+STREAM_MAGIC = b"PTSQ"
+STREAM_VERSION = 1  # StreamingImageSequence::version
+
+MAX_LITERAL = 128
+MAX_REPEAT = 65
+MAX_SKIP = 64
+
+
+def parse_array(text):
+    return bytes(int(v) for v in re.findall(r"\d+", text))
+
+
+def read_sequence(path):
+    with open(path) as file:
+        text = file.read()
+
+    frames = {name: parse_array(body) for name, body in re.findall(r"::(frame\d+)\[\]\s*(?:PROGMEM)?\s*=\s*\{([^}]*)\}", text)}
+    order = re.search(r"::sequence\[\]\s*=\s*\{([^}]*)\}", text)
+    colors = re.search(r"::rgbColors\[\]\s*(?:PROGMEM)?\s*=\s*\{([^}]*)\}", text)
+    image = re.search(r"Image\(\s*\w+\s*,\s*rgbColors\s*,\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*\)", text)
+
+    if not frames or not order or not colors or not image:
+        sys.exit("No ImageSequence found in " + path)
+
+    names = [name.strip() for name in order.group(1).split(",") if name.strip()]
+    width, height, color_count = (int(v) for v in image.groups())
+
+    sequence = []
+    for name in names:
+        if name not in frames:
+            sys.exit("Frame %s is used by the sequence but not defined" % name)
+        if len(frames[name]) != width * height:
+            sys.exit("Frame %s has %d pixels, expected %d" % (name, len(frames[name]), width * height))
+        sequence.append(frames[name])
+
+    return sequence, parse_array(colors.group(1)), width, height, color_count
+
+
+def run_length(data, start, limit, value=None):
+    value = data[start] if value is None else value
+    end = start
+    while end < len(data) and end - start < limit and data[end] == value:
+        end += 1
+    return end - start
+
+
+def skip_length(frame, previous, start):
+    end = start
+    while end < len(frame) and end - start < MAX_SKIP and frame[end] == previous[end]:
+        end += 1
+    return end - start
+
+
+def encode_frame(frame, previous=None):
+    """Greedy tokenizer: skips unchanged pixels, repeats runs of three or more, everything else goes out as literals."""
+    out = bytearray([KEY_FRAME if previous is None else DELTA_FRAME])
+    tokens = 0
+    pixel = 0
+
+    while pixel < len(frame):
+        if previous is not None:
+            skip = skip_length(frame, previous, pixel)
+            if skip >= 2 or (skip == 1 and run_length(frame, pixel, MAX_REPEAT) < 3):
+                out.append(0xC0 + skip - 1)
+                pixel += skip
+                tokens += 1
+                continue
+
+        repeat = run_length(frame, pixel, MAX_REPEAT)
+        if repeat >= 3:
+            out.append(0x80 + repeat - 2)
+            out.append(frame[pixel])
+            pixel += repeat
+            tokens += 1
+            continue
+
+        # literal until the next run or skip worth a token of its own
+        end = pixel
+        while end < len(frame) and end - pixel < MAX_LITERAL:
+            if run_length(frame, end, 3) >= 3:
+                break
+            if previous is not None and end > pixel and skip_length(frame, previous, end) >= 3:
+                break
+            end += 1
+        end = max(end, pixel + 1)
+
+        out.append(end - pixel - 1)
+        out.extend(frame[pixel:end])
+        pixel = end
+        tokens += 1
+
+    return bytes(out), tokens
+
+
+def decode_frame(data, output):
+    """Mirror of CompressedImageSequence::DecodeFrame, used to verify every frame."""
+    position = 1
+    pixel = 0
+
+    while position < len(data) and pixel < len(output):
+        token = data[position]
+        position += 1
+
+        if token < 0x80:
+            count = token + 1
+            output[pixel:pixel + count] = data[position:position + count]
+            position += count
+            pixel += count
+        elif token < 0xC0:
+            count = token - 0x80 + 2
+            output[pixel:pixel + count] = bytes([data[position]]) * count
+            position += 1
+            pixel += count
+        else:
+            pixel += token - 0xC0 + 1
+
+    return pixel >= len(output)
+
+
+def encode_sequence(sequence, key_interval):
+    encoded = []
+    since_key = 0
+
+    for index, frame in enumerate(sequence):
+        key, key_tokens = encode_frame(frame)
+
+        if index == 0 or (key_interval > 0 and since_key >= key_interval):
+            encoded.append((key, key_tokens))
+            since_key = 1
+            continue
+
+        delta, delta_tokens = encode_frame(frame, sequence[index - 1])
+
+        if len(key) <= len(delta):
+            encoded.append((key, key_tokens))
+            since_key = 1
+        else:
+            encoded.append((delta, delta_tokens))
+            since_key += 1
+
+    return encoded
+
+
+def verify(sequence, encoded):
+    buffer = bytearray(len(sequence[0]))
+    start = time.perf_counter()
+
+    for index, (data, _) in enumerate(encoded):
+        if not decode_frame(data, buffer) or bytes(buffer) != sequence[index]:
+            sys.exit("Frame %d does not decode back to the source, encoder bug" % index)
+
+    return (time.perf_counter() - start) / len(encoded)
+
+
+def format_array(values, per_line=64):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("\t" + ",".join(str(v) for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def write_header(path, name, source, encoded, colors, width, height, color_count, fps):
+    stream = bytearray()
+    offsets = []
+    for data, _ in encoded:
+        offsets.append(len(stream))
+        stream.extend(data)
+    offsets.append(len(stream))
+
+    class_name = name + "CompressedSequence"
+
+    out = [
+        "#pragma once",
+        "",
+        '#include "Utils\\CompressedImageSequence.h"',
+        "",
+        "//Generated by tools/ImageSequenceEncoder.py from " + os.path.basename(source) + ", do not edit by hand",
+        "class %s : public CompressedImageSequence{" % class_name,
+        "private:",
+        "\tstatic const uint8_t frames[];",
+        "\tstatic const uint32_t frameOffsets[];",
+        "\tstatic const uint8_t rgbColors[];",
+        "",
+        "\tImage image = Image(nullptr, rgbColors, %d, %d, %d);" % (width, height, color_count),
+        "",
+        "public:",
+        "\t%s(Vector2D size, Vector2D offset, float fps = %s) : CompressedImageSequence(&image, frames, frameOffsets, (unsigned int)%d, fps) {" % (class_name, repr(float(fps)) + "f", len(encoded)),
+        "\t\timage.SetSize(size);",
+        "\t\timage.SetPosition(offset);",
+        "\t}",
+        "};",
+        "",
+        "const uint8_t %s::frames[] PROGMEM = {\n%s\n};" % (class_name, format_array(stream)),
+        "",
+        "const uint32_t %s::frameOffsets[] PROGMEM = {\n%s\n};" % (class_name, format_array(offsets, 16)),
+        "",
+        "const uint8_t %s::rgbColors[] PROGMEM = {\n%s\n};" % (class_name, format_array(colors)),
+        "",
+    ]
+
+    with open(path, "w", newline="\n") as file:
+        file.write("\n".join(out))
+
+    return len(stream) + len(offsets) * 4
+
+
+def write_stream(path, encoded, colors, width, height, fps):
+    """Header, palette and one length prefixed chunk per frame, the layout read by StreamingImageSequence."""
+    max_chunk = max(len(data) for data, _ in encoded)
+
+    with open(path, "wb") as file:
+        file.write(STREAM_MAGIC + struct.pack("<BBHHHIIf", STREAM_VERSION, 0, width, height, len(colors), len(encoded), max_chunk, fps))
+        file.write(colors)
+        for data, _ in encoded:
+            file.write(struct.pack("<I", len(data)))
+            file.write(data)
+
+        return file.tell()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="ImageSequence header, e.g. Assets/Textures/Animated/BadApple.h")
+    parser.add_argument("--name", required=True, help="prefix for the generated class, e.g. BadApple")
+    parser.add_argument("-o", "--output", help="file to write, defaults to <name>Compressed.h or <name>.pts with --stream")
+    parser.add_argument("--stream", action="store_true", help="write a StreamingImageSequence file instead of a header")
+    parser.add_argument("--key-interval", type=int, default=30, help="frames between forced keyframes, bounds the catch up after a seek, 0 for only when smaller")
+    parser.add_argument("--fps", type=float, default=24.0, help="default frame rate of the generated constructor")
+    parser.add_argument("--report-only", action="store_true", help="print the compression report without writing a header")
+    args = parser.parse_args()
+
+    sequence, colors, width, height, color_count = read_sequence(args.input)
+    encoded = encode_sequence(sequence, args.key_interval)
+    decode_seconds = verify(sequence, encoded)
+
+    raw = len(sequence) * width * height
+    keyframes = sum(1 for data, _ in encoded if data[0] == KEY_FRAME)
+    sizes = [len(data) for data, _ in encoded]
+    tokens = [count for _, count in encoded]
+
+    if args.report_only:
+        flash = sum(sizes) + (len(sizes) + 1) * 4
+    elif args.stream:
+        output = args.output or args.name + ".pts"
+        flash = write_stream(output, encoded, colors, width, height, args.fps)
+        print("%s written" % output)
+        print("read buffers %d bytes, prefetch above %d bytes per frame at %g fps" % (2 * max(sizes), sum(sizes) // len(sizes), args.fps))
+    else:
+        output = args.output or args.name + "Compressed.h"
+        flash = write_header(output, args.name, args.input, encoded, colors, width, height, color_count, args.fps)
+        print("%s written" % output)
+
+    print("%d frames of %d x %d, %d keyframes" % (len(sequence), width, height, keyframes))
+    print("frame data %d -> %d bytes%s, ratio %.1f:1" % (raw, flash, " in the file" if args.stream else " with offsets", raw / float(flash)))
+    print("bytes per frame: average %d, largest %d" % (sum(sizes) // len(sizes), max(sizes)))
+    print("tokens per frame: average %d, largest %d" % (sum(tokens) // len(tokens), max(tokens)))
+    print("RAM frame buffer %d bytes" % (width * height))
+    print("python reference decode %.2f ms per frame, on the device read CompressedImageSequence::GetDecodeTime()" % (decode_seconds * 1000.0))
+
+
+if __name__ == "__main__":
+    main()
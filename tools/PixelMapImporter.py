@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+"""Generates a PixelMap header for ProtoTracer from a list of pixel coordinates.
+
+Supported inputs:
+    .csv    x,y per line, an optional header row and extra columns are ignored
+    .svg    <circle cx cy> and <rect x y width height> centers, in document order
+    .pos    KiCad footprint position files, only references matching --ref are kept
+    .h      existing ProtoTracer Vector2D(x, y) arrays
+
+Example:
+    python tools/PixelMapImporter.py panel.csv --name P3HUB75 -o lib/ProtoTracer/Camera/Pixels/PixelGroups/P3HUB75Map.h
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+import xml.etree.ElementTree as ElementTree
+
+NO_NEIGHBOR = 0xFFFF
+NEIGHBOR_TOLERANCE = 1.0  # matches Mathematics::IsClose(..., 1.0f) in PixelGroup::GridSort
+
+
+def read_csv(path, args):
+    points = []
+    with open(path) as file:
+        for line in file:
+            fields = [f.strip() for f in re.split(r"[,;\t]", line.strip())]
+            if len(fields) < 2:
+                continue
+            try:
+                points.append((float(fields[0]), float(fields[1])))
+            except ValueError:
+                continue  # header or comment row
+    return points
+
+
+def strip_namespace(tag):
+    return tag.split("}")[-1]
+
+
+def read_svg(path, args):
+    points = []
+    for element in ElementTree.parse(path).iter():
+        tag = strip_namespace(element.tag)
+        if tag == "circle" or tag == "ellipse":
+            points.append((float(element.get("cx", 0)), float(element.get("cy", 0))))
+        elif tag == "rect":
+            x = float(element.get("x", 0))
+            y = float(element.get("y", 0))
+            points.append((x + float(element.get("width", 0)) / 2.0, y + float(element.get("height", 0)) / 2.0))
+    return points
+
+
+def read_kicad_pos(path, args):
+    points = []
+    reference = re.compile(args.ref)
+    with open(path) as file:
+        for line in file:
+            if line.startswith("#") or not line.strip():
+                continue
+            fields = line.split()
+            # Ref Val Package PosX PosY Rot Side
+            if len(fields) >= 5 and reference.match(fields[0]):
+                points.append((fields[0], float(fields[3]), float(fields[4])))
+    if args.sort_ref:
+        points.sort(key=lambda p: [int(t) if t.isdigit() else t for t in re.split(r"(\d+)", p[0])])
+    return [(p[1], p[2]) for p in points]
+
+
+def read_header(path, args):
+    with open(path) as file:
+        text = file.read()
+    number = r"([-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)f?"
+    return [(float(x), float(y)) for x, y in re.findall(r"Vector2D\(\s*" + number + r"\s*,\s*" + number + r"\s*\)", text)]
+
+
+READERS = {".csv": read_csv, ".txt": read_csv, ".svg": read_svg, ".pos": read_kicad_pos, ".h": read_header}
+
+
+def transform(points, args):
+    result = []
+    for x, y in points:
+        x, y = x * args.scale, y * args.scale
+        if args.flip_y:
+            y = -y
+        result.append((x, y))
+
+    if args.origin:
+        min_x = min(p[0] for p in result)
+        min_y = min(p[1] for p in result)
+        result = [(x - min_x, y - min_y) for x, y in result]
+
+    return result
+
+
+def is_close(a, b, tolerance):
+    return abs(a - b) <= tolerance
+
+
+def grid_sort(points):
+    """Same neighbour search as PixelGroup::GridSort, done once on the host instead of at boot."""
+    count = len(points)
+    up, down, left, right = ([NO_NEIGHBOR] * count for _ in range(4))
+
+    for i, (cx, cy) in enumerate(points):
+        min_up = min_down = min_left = min_right = float("inf")
+
+        for j, (nx, ny) in enumerate(points):
+            if i == j:
+                continue
+
+            dist = math.hypot(cx - nx, cy - ny)
+
+            if is_close(cx, nx, NEIGHBOR_TOLERANCE):
+                if cy < ny and dist < min_up:
+                    min_up, up[i] = dist, j
+                elif cy > ny and dist < min_down:
+                    min_down, down[i] = dist, j
+
+            if is_close(cy, ny, NEIGHBOR_TOLERANCE):
+                if cx > nx and dist < min_left:
+                    min_left, left[i] = dist, j
+                elif cx < nx and dist < min_right:
+                    min_right, right[i] = dist, j
+
+    return up, down, left, right
+
+
+def find_row_count(points):
+    """Returns pixels per row if the points form an evenly spaced row-major grid, otherwise None."""
+    count = len(points)
+    if count < 2:
+        return None
+
+    row_count = 1
+    while row_count < count and is_close(points[row_count][1], points[0][1], 1e-3):
+        row_count += 1
+
+    if count % row_count != 0:
+        return None
+
+    col_count = count // row_count
+    min_x, min_y = points[0]
+    max_x, max_y = points[-1]
+    pitch_x = (max_x - min_x) / (row_count - 1) if row_count > 1 else 0.0
+    pitch_y = (max_y - min_y) / (col_count - 1) if col_count > 1 else 0.0
+
+    if (row_count > 1 and pitch_x <= 0.0) or (col_count > 1 and pitch_y <= 0.0):
+        return None
+
+    tolerance = 1e-3 * max(pitch_x, pitch_y, 1.0)
+    for i, (x, y) in enumerate(points):
+        if not is_close(x, min_x + (i % row_count) * pitch_x, tolerance) or not is_close(y, min_y + (i // row_count) * pitch_y, tolerance):
+            return None
+
+    return row_count
+
+
+def find_scale(points):
+    """Smallest power of two step that keeps every coordinate inside int16."""
+    largest = max(max(abs(x), abs(y)) for x, y in points)
+    exponent = -15
+    while largest / (2.0 ** exponent) > 32767.0:
+        exponent += 1
+    return 2.0 ** exponent
+
+
+def format_float(value):
+    text = ("%.4f" % value).rstrip("0")
+    return text + ("0f" if text.endswith(".") else "f")
+
+
+def format_array(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def write_header(path, name, points, source, quantization_error):
+    count = len(points)
+    min_x = min(p[0] for p in points)
+    min_y = min(p[1] for p in points)
+    max_x = max(p[0] for p in points)
+    max_y = max(p[1] for p in points)
+    row_count = find_row_count(points)
+
+    out = ["#pragma once", "", '#include "..\\PixelMap.h"', "", "//Generated by tools/PixelMapImporter.py from " + os.path.basename(source) + ", do not edit by hand", ""]
+
+    bounds = "Vector2D(%s, %s), Vector2D(%s, %s)" % (format_float(min_x), format_float(min_y), format_float(max_x), format_float(max_y))
+
+    if row_count:
+        out.append("//%d x %d evenly spaced grid" % (row_count, count // row_count))
+        out.append("PixelMap %sMap(%d, %d, %s);" % (name, count, row_count, bounds))
+    else:
+        scale = find_scale(points)
+        coordinates = []
+        for x, y in points:
+            coordinates.append(int(round(x / scale)))
+            coordinates.append(int(round(y / scale)))
+
+        up, down, left, right = grid_sort(points)
+
+        out.append("//Quantization step %g, max error %g" % (scale, quantization_error(points, scale)))
+        out.append("const int16_t %sCoordinates[%d] PROGMEM = {\n%s\n};" % (name, count * 2, format_array(coordinates)))
+        out.append("")
+        for table_name, table in (("Up", up), ("Down", down), ("Left", left), ("Right", right)):
+            out.append("const uint16_t %s%s[%d] PROGMEM = {\n%s\n};" % (name, table_name, count, format_array(table)))
+            out.append("")
+        out.append("PixelMap %sMap(%sCoordinates, %sUp, %sDown, %sLeft, %sRight, %d, %s, %s);" % (name, name, name, name, name, name, count, repr(scale) + "f", bounds))
+
+    out.append("")
+
+    with open(path, "w", newline="\n") as file:
+        file.write("\n".join(out))
+
+    return row_count
+
+
+def max_quantization_error(points, scale):
+    return max(max(abs(x - round(x / scale) * scale), abs(y - round(y / scale) * scale)) for x, y in points)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="CSV, SVG, KiCad .pos or Vector2D header")
+    parser.add_argument("--name", required=True, help="prefix for the generated symbols, e.g. P3HUB75")
+    parser.add_argument("-o", "--output", help="header to write, defaults to <name>Map.h")
+    parser.add_argument("--scale", type=float, default=1.0, help="multiplier applied to the input units")
+    parser.add_argument("--flip-y", action="store_true", help="negate Y, SVG and KiCad use a downward Y axis")
+    parser.add_argument("--origin", action="store_true", help="shift the layout so the minimum corner is at 0,0")
+    parser.add_argument("--ref", default="D", help="KiCad reference prefix regex for LED footprints")
+    parser.add_argument("--sort-ref", action="store_true", help="order KiCad parts by reference number instead of file order")
+    args = parser.parse_args()
+
+    extension = os.path.splitext(args.input)[1].lower()
+    if extension not in READERS:
+        sys.exit("Unsupported input type: " + extension)
+
+    points = transform(READERS[extension](args.input, args), args)
+    if len(points) == 0:
+        sys.exit("No pixels found in " + args.input)
+    if len(points) >= NO_NEIGHBOR:
+        sys.exit("Too many pixels, neighbour tables are limited to %d entries" % (NO_NEIGHBOR - 1))
+
+    output = args.output or args.name + "Map.h"
+    row_count = write_header(output, args.name, points, args.input, max_quantization_error)
+
+    if row_count:
+        print("%s: %d pixels, rectangular %d x %d, no per-pixel data" % (output, len(points), row_count, len(points) // row_count))
+    else:
+        print("%s: %d pixels, irregular, %d bytes of flash" % (output, len(points), len(points) * 12))
+
+
+if __name__ == "__main__":
+    main()